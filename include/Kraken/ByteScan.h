@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file ByteScan.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_BYTESCAN_H
+#define KRAKEN_BYTESCAN_H
+
+#include <stddef.h>
+
+namespace Kraken
+{
+    /**
+     * Finds the first occurrence of a byte in a buffer.
+     *
+     * Scans 32 (AVX2) or 16 (SSE2/NEON) bytes at a time, depending on the target the library is built for.
+     *
+     * @param buffer    The buffer to scan.
+     * @param length    The size of the buffer, in bytes.
+     * @param value     The byte to look for.
+     *
+     * @return The address of the first occurrence; `nullptr` if there is none.
+     */
+    const void *FindByte(const void *buffer, size_t length, unsigned char value);
+
+    /**
+     * Finds the first occurrence of a two-byte sequence (e.g. CRLF) in a buffer.
+     *
+     * @param buffer    The buffer to scan.
+     * @param length    The size of the buffer, in bytes.
+     * @param first     The first byte of the sequence.
+     * @param second    The second byte of the sequence.
+     *
+     * @return The address of the first byte of the first occurrence; `nullptr` if there is none.
+     */
+    const void *FindBytePair(const void *buffer, size_t length, unsigned char first, unsigned char second);
+}
+
+#endif //KRAKEN_BYTESCAN_H
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file Checksum.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_CHECKSUM_H
+#define KRAKEN_CHECKSUM_H
+
+#include <Kraken/membuf.h>
+#include <stdint.h>
+
+namespace Kraken
+{
+    /**
+     * Computes the CRC-32C (Castagnoli) checksum of a buffer.
+     *
+     * The checksum can be computed incrementally by passing the result of the previous call as `crc`.
+     *
+     * @param buffer    The data to checksum.
+     * @param length    The size of the buffer, in bytes.
+     * @param crc       The checksum of the preceding data, or `0`.
+     *
+     * @return The checksum.
+     */
+    uint32_t Crc32c(const void *buffer, size_t length, uint32_t crc = 0);
+
+    /**
+     * Computes the CRC-32C (Castagnoli) checksum of a membuf.
+     *
+     * @param mem   The data to checksum.
+     * @param crc   The checksum of the preceding data, or `0`.
+     *
+     * @return The checksum.
+     */
+    inline uint32_t Crc32c(const_membuf mem, uint32_t crc = 0)
+    {
+        return Crc32c(mem.buffer, mem.length, crc);
+    }
+}
+
+#endif //KRAKEN_CHECKSUM_H
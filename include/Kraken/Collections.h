@@ -157,5 +157,98 @@ namespace Kraken
      */
     template <size_t N>
     using buffer = array<unsigned char, N>;
+
+    /**
+     * A byte buffer whose address is aligned to a given boundary.
+     * Meant mainly for direct IO (`EFileFlags::Direct`), which requires the buffer, the length
+     * and the file offset to be aligned to the logical block size of the device.
+     *
+     * @tparam N        The size of the buffer, in bytes.
+     * @tparam Align    The alignment of the buffer. Must be a power of two.
+     */
+    template <size_t N, size_t Align = 4096>
+    struct aligned_buffer
+    {
+        static_assert((Align > 0) && ((Align & (Align - 1)) == 0), "Align must be a power of two.");
+
+        typedef unsigned char (&native_array_ref)[N];
+
+    private:
+        /**
+         * Internal data representation
+         */
+        alignas(Align) unsigned char data[N];
+
+    public:
+        /**
+         * Default constructor.
+         */
+        aligned_buffer() = default;
+
+        /**
+         * Initialize all of the buffer's bytes with a default value.
+         * @param defaultValue
+         */
+        aligned_buffer(unsigned char defaultValue)
+        {
+            memset(data, defaultValue, N);
+        }
+
+        /**
+         * @return The size of the buffer, in bytes.
+         */
+        constexpr size_t length() const { return N; }
+
+        /**
+         * @return The alignment of the buffer's address.
+         */
+        constexpr size_t alignment() const { return Align; }
+
+        /**
+         * Unsafe accessor to the underlying bytes.
+         *
+         * @param index     The index of the wanted byte.
+         * @return A reference to the byte at the specified index.
+         */
+        inline unsigned char &operator [](size_t index)
+        {
+            return data[index];
+        }
+
+        /**
+         * Unsafe accessor to the underlying bytes.
+         *
+         * @param index     The index of the wanted byte.
+         * @return A const-reference to the byte at the specified index.
+         */
+        inline const unsigned char &operator [](size_t index) const
+        {
+            return data[index];
+        }
+
+        /**
+         * Casts this buffer into a `membuf`.
+         */
+        operator membuf()
+        {
+            return membuf(data);
+        }
+
+        /**
+         * Casts this buffer into a `const_membuf`.
+         */
+        operator const_membuf() const
+        {
+            return const_membuf(data);
+        }
+
+        /**
+         * Casts this buffer into a native-array reference.
+         */
+        operator native_array_ref()
+        {
+            return data;
+        }
+    };
 }
 #endif //KRAKEN_COLLECTIONS_H
\ No newline at end of file
@@ -34,6 +34,12 @@
  *  - KRAKEN_OPT_DISABLE_PREADV
  *  - KRAKEN_OPT_DISABLE_WRITEV
  *  - KRAKEN_OPT_DISABLE_PWRITEV
+ *  - KRAKEN_OPT_DISABLE_PREADV2
+ *  - KRAKEN_OPT_DISABLE_PWRITEV2
+ *  - KRAKEN_OPT_DISABLE_MEMFD_CREATE
+ *  - KRAKEN_OPT_DISABLE_GETDENTS64
+ *  - KRAKEN_OPT_DISABLE_OPENAT2
+ *  - KRAKEN_OPT_DISABLE_SIMD
  *
  * Available missing feature handlers:
  *  - KRAKEN_OPT_MISSING_FUNC_ABORT
@@ -32,6 +32,9 @@
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <arpa/inet.h>
+#include <net/if.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
 
 namespace Kraken
 {
@@ -40,6 +43,19 @@ namespace Kraken
         Unix = AF_UNIX,
         IPv4 = AF_INET,
         IPv6 = AF_INET6,
+        Packet = AF_PACKET,
+    };
+
+    /**
+     * The classification of a frame received by a packet socket.
+     */
+    enum class EPacketType
+    {
+        Host = PACKET_HOST,
+        Broadcast = PACKET_BROADCAST,
+        Multicast = PACKET_MULTICAST,
+        OtherHost = PACKET_OTHERHOST,
+        Outgoing = PACKET_OUTGOING,
     };
 
     /**
@@ -313,7 +329,7 @@ namespace Kraken
             return sizeof(data);
         }
 
-        inline void SetLength(socklen_t newLength)
+        inline void SetLength(socklen_t /* newLength */)
         {
             // Knowingly left empty.
         }
@@ -383,7 +399,7 @@ namespace Kraken
             return sizeof(data);
         }
 
-        inline void SetLength(socklen_t newLength)
+        inline void SetLength(socklen_t /* newLength */)
         {
             // Knowingly left empty.
         }
@@ -404,9 +420,144 @@ namespace Kraken
         }
     };
 
+    template<>
+    struct Address<ESocketDomain::Packet>
+    {
+        static constexpr socklen_t s_MaxSize = sizeof(sockaddr_ll);
+        struct sockaddr_ll data;
+
+        Address()
+        {
+            memset(&data, 0, sizeof(data));
+            data.sll_family = ~(sa_family_t)AF_PACKET;
+        }
+
+        /**
+         * Tries to initialise this address with an interface name.
+         *
+         * @note This call may fail; you can check with @ref IsValid
+         *
+         * @param interfaceName The name of the interface (e.g. `"lo"`).
+         * @param protocol      The ethertype to capture or send, in host byte order.
+         */
+        Address(const char *interfaceName, uint16_t protocol = ETH_P_ALL) : Address()
+        {
+            Init(interfaceName, protocol);
+        }
+
+        /**
+         * Initialises this address with an interface index.
+         *
+         * @param interfaceIndex    The index of the interface; `0` matches any interface (bind only).
+         * @param protocol          The ethertype to capture or send, in host byte order.
+         */
+        Address(int interfaceIndex, uint16_t protocol = ETH_P_ALL) : Address()
+        {
+            Init(interfaceIndex, protocol);
+        }
+
+        bool Init(const char *interfaceName, uint16_t protocol)
+        {
+            unsigned int interfaceIndex;
+
+            data.sll_family = ~(sa_family_t)AF_PACKET; // Invalidate address.
+
+            if (interfaceName == nullptr)
+            {
+                KRAKEN_PRINT("Null parameter: interfaceName");
+                return false;
+            }
+
+            interfaceIndex = if_nametoindex(interfaceName);
+            if (interfaceIndex == 0)
+            {
+                KRAKEN_PRINT("Unknown interface. errno = %d", errno);
+                return false;
+            }
+
+            return Init((int)interfaceIndex, protocol);
+        }
+
+        bool Init(int interfaceIndex, uint16_t protocol)
+        {
+            memset(&data, 0, sizeof(data));
+
+            data.sll_family = AF_PACKET;
+            data.sll_protocol = htons(protocol);
+            data.sll_ifindex = interfaceIndex;
+            return true;
+        }
+
+        /**
+         * Sets the destination hardware address, for sending.
+         *
+         * @param address   The hardware address.
+         * @param length    The length of the address (e.g. `ETH_ALEN`). At most 8 bytes.
+         * @return `true` on success; `false` on invalid input.
+         */
+        bool SetHardwareAddress(const uint8_t *address, size_t length)
+        {
+            if ((address == nullptr) || (length > sizeof(data.sll_addr)))
+            {
+                return false;
+            }
+
+            memcpy(data.sll_addr, address, length);
+            data.sll_halen = (unsigned char)length;
+            return true;
+        }
+
+        inline int GetInterfaceIndex() const
+        {
+            return data.sll_ifindex;
+        }
+
+        /**
+         * @return The ethertype, in host byte order.
+         */
+        inline uint16_t GetProtocol() const
+        {
+            return ntohs(data.sll_protocol);
+        }
+
+        /**
+         * @return The classification of a received frame.
+         */
+        inline EPacketType GetPacketType() const
+        {
+            return (EPacketType)data.sll_pkttype;
+        }
+
+        inline socklen_t GetLength() const
+        {
+            return sizeof(data);
+        }
+
+        inline void SetLength(socklen_t /* newLength */)
+        {
+            // Knowingly left empty.
+        }
+
+        inline sockaddr *GetBase()
+        {
+            return (sockaddr *)&data;
+        }
+
+        inline const sockaddr *GetBase() const
+        {
+            return (sockaddr *)&data;
+        }
+
+        inline bool IsValid() const
+        {
+            return data.sll_family == AF_PACKET;
+        }
+    };
+
     using UnixAddress = struct Address<ESocketDomain::Unix>;
     using IPv4Address = struct Address<ESocketDomain::IPv4>;
     using IPv6Address = struct Address<ESocketDomain::IPv6>;
+    using PacketAddress = struct Address<ESocketDomain::Packet>;
 }
 
 #endif //KRAKEN_ADDRESS_H
@@ -0,0 +1,434 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file BufferedStream.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#ifndef KRAKEN_BUFFEREDSTREAM_H
+#define KRAKEN_BUFFEREDSTREAM_H
+
+#include <Kraken/Definitions.h>
+#include <Kraken/IO/IStream.h>
+#include <errno.h>
+#include <string.h>
+
+namespace Kraken
+{
+    /**
+     * Coalesces small writes into a fixed internal buffer before handing them to a stream.
+     *
+     * Writes that are at least as large as the buffer bypass it (after flushing whatever is buffered),
+     * so the data is never copied twice.
+     *
+     * @tparam N    The size of the internal buffer, in bytes.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <size_t N>
+    class BufferedWriter
+    {
+        static_assert(N > 0, "N must be positive.");
+
+    public:
+        /**
+         * Constructs a writer over the given stream.
+         *
+         * @param stream    The stream to write to. Must outlive the writer.
+         */
+        BufferedWriter(IStream &stream) :
+                m_stream(stream),
+                m_length(0)
+        {}
+
+        /**
+         * Flushes any remaining data.
+         */
+        ~BufferedWriter()
+        {
+            Flush();
+        }
+
+        /**
+         * Writes the given buffer through the internal buffer.
+         *
+         * @param buffer    The buffer containing the data to write.
+         * @param length    The size of the buffer, in bytes.
+         *
+         * @return `length` on success; `-errno` on error.
+         *          A large write that failed midway returns the amount of bytes that were written.
+         */
+        ssize_t Write(const void *buffer, size_t length)
+        {
+            int err;
+
+            if (buffer == nullptr)
+            {
+                KRAKEN_PRINT("Null parameter (`buffer`).");
+                return -EINVAL;
+            }
+
+            if (m_length + length > N)
+            {
+                err = Flush();
+                if (err != 0)
+                {
+                    return err;
+                }
+            }
+
+            if (length >= N)
+            {
+                return WriteAll((const unsigned char *)buffer, length);
+            }
+
+            memcpy(m_buffer + m_length, buffer, length);
+            m_length += length;
+
+            return (ssize_t)length;
+        }
+
+        /**
+         * Writes the given membuf through the internal buffer.
+         *
+         * @param mem   The membuf to write.
+         * @return The size of the membuf on success; `-errno` on error.
+         */
+        inline ssize_t Write(const_membuf mem)
+        {
+            return Write(mem.buffer, mem.length);
+        }
+
+        /**
+         * Writes all of the buffered data to the stream.
+         *
+         * @note On error, the data that wasn't written stays buffered.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Flush()
+        {
+            size_t offset = 0;
+            ssize_t res = 0;
+
+            while (offset < m_length)
+            {
+                res = m_stream.Write(m_buffer + offset, m_length - offset);
+                if (res <= 0)
+                {
+                    break;
+                }
+
+                offset += (size_t)res;
+            }
+
+            if (offset < m_length)
+            {
+                memmove(m_buffer, m_buffer + offset, m_length - offset);
+            }
+            m_length -= offset;
+
+            if (m_length == 0)
+            {
+                return 0;
+            }
+
+            return (res < 0) ? (int)res : -EIO;
+        }
+
+        /**
+         * @return The amount of bytes waiting to be flushed.
+         */
+        inline size_t GetBufferedLength() const
+        {
+            return m_length;
+        }
+
+        /**
+         * @return The size of the internal buffer.
+         */
+        constexpr size_t Capacity() const
+        {
+            return N;
+        }
+
+    private:
+        BufferedWriter(const BufferedWriter &) = delete;
+
+        ssize_t WriteAll(const unsigned char *buffer, size_t length)
+        {
+            size_t offset = 0;
+
+            while (offset < length)
+            {
+                ssize_t res = m_stream.Write(buffer + offset, length - offset);
+                if (res < 0)
+                {
+                    return (offset > 0) ? (ssize_t)offset : res;
+                }
+                else if (res == 0)
+                {
+                    break;
+                }
+
+                offset += (size_t)res;
+            }
+
+            return (ssize_t)offset;
+        }
+
+        IStream &m_stream;
+        size_t m_length;
+        unsigned char m_buffer[N];
+    };
+
+    /**
+     * Reads from a stream in chunks of up to `N` bytes, and serves smaller reads from the internal buffer.
+     *
+     * @tparam N    The size of the internal buffer, in bytes.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <size_t N>
+    class BufferedReader
+    {
+        static_assert(N > 0, "N must be positive.");
+
+    public:
+        /**
+         * Constructs a reader over the given stream.
+         *
+         * @param stream    The stream to read from. Must outlive the reader.
+         */
+        BufferedReader(IStream &stream) :
+                m_stream(stream),
+                m_start(0),
+                m_end(0)
+        {}
+
+        /**
+         * Reads up to `length` bytes.
+         * Buffered data is returned first; if there is none, reads of at least `N` bytes bypass the buffer.
+         *
+         * @param o_buffer  The buffer to fill with data.
+         * @param length    The size of the buffer, in bytes.
+         *
+         * @note The function may return a valid-value that is smaller than `length`.
+         *
+         * @return The amount of bytes read on success (`0` on end of stream); `-errno` otherwise.
+         */
+        ssize_t Read(void *o_buffer, size_t length)
+        {
+            if (o_buffer == nullptr)
+            {
+                KRAKEN_PRINT("Null parameter (`o_buffer`).");
+                return -EINVAL;
+            }
+
+            if (GetBufferedLength() == 0)
+            {
+                if (length >= N)
+                {
+                    return m_stream.Read(o_buffer, length);
+                }
+
+                ssize_t res = Fill();
+                if (res <= 0)
+                {
+                    return res;
+                }
+            }
+
+            size_t count = (length < GetBufferedLength()) ? length : GetBufferedLength();
+            memcpy(o_buffer, m_buffer + m_start, count);
+            Consume(count);
+
+            return (ssize_t)count;
+        }
+
+        /**
+         * Reads up to `length` bytes into the given membuf.
+         *
+         * @param o_mem The membuf to fill.
+         * @return The amount of bytes read on success (`0` on end of stream); `-errno` otherwise.
+         */
+        inline ssize_t Read(membuf o_mem)
+        {
+            return Read(o_mem.buffer, o_mem.length);
+        }
+
+        /**
+         * Reads more data from the stream into the free space of the internal buffer.
+         *
+         * @return The amount of bytes read on success (`0` on end of stream);
+         *          `-ENOBUFS` if the buffer is full; `-errno` on error.
+         */
+        ssize_t Fill()
+        {
+            ssize_t res;
+
+            if (m_start > 0)
+            {
+                memmove(m_buffer, m_buffer + m_start, m_end - m_start);
+                m_end -= m_start;
+                m_start = 0;
+            }
+
+            if (m_end == N)
+            {
+                return -ENOBUFS;
+            }
+
+            res = m_stream.Read(m_buffer + m_end, N - m_end);
+            if (res > 0)
+            {
+                m_end += (size_t)res;
+            }
+
+            return res;
+        }
+
+        /**
+         * Returns a view of the buffered data, without consuming it.
+         *
+         * @note The view is invalidated by any other non-const call.
+         */
+        inline const_membuf Peek() const
+        {
+            return const_membuf(m_buffer + m_start, m_end - m_start);
+        }
+
+        /**
+         * Discards buffered data.
+         *
+         * @param length    The amount of bytes to discard. Clamped to the amount of buffered data.
+         */
+        inline void Consume(size_t length)
+        {
+            m_start += (length < GetBufferedLength()) ? length : GetBufferedLength();
+
+            if (m_start == m_end)
+            {
+                m_start = 0;
+                m_end = 0;
+            }
+        }
+
+        /**
+         * Reads up to, and including, the first occurrence of `delimiter`.
+         *
+         * @param delimiter The byte to stop at.
+         * @param o_buffer  The buffer to fill with data.
+         * @param length    The size of the buffer, in bytes.
+         *
+         * @note The read is complete only if the last returned byte is the delimiter;
+         *          otherwise either `o_buffer` got full, or the stream has ended.
+         *
+         * @return The amount of bytes read on success (`0` on end of stream); `-errno` otherwise.
+         */
+        ssize_t ReadUntil(unsigned char delimiter, void *o_buffer, size_t length)
+        {
+            unsigned char *output = (unsigned char *)o_buffer;
+            size_t total = 0;
+
+            if (o_buffer == nullptr)
+            {
+                KRAKEN_PRINT("Null parameter (`o_buffer`).");
+                return -EINVAL;
+            }
+
+            while (total < length)
+            {
+                if (GetBufferedLength() == 0)
+                {
+                    ssize_t res = Fill();
+                    if (res <= 0)
+                    {
+                        return (total > 0) ? (ssize_t)total : res;
+                    }
+                }
+
+                size_t available = length - total;
+                size_t count = (available < GetBufferedLength()) ? available : GetBufferedLength();
+                const unsigned char *start = m_buffer + m_start;
+                const void *found = memchr(start, delimiter, count);
+
+                if (found != nullptr)
+                {
+                    count = (size_t)((const unsigned char *)found - start) + 1;
+                }
+
+                memcpy(output + total, start, count);
+                Consume(count);
+                total += count;
+
+                if (found != nullptr)
+                {
+                    break;
+                }
+            }
+
+            return (ssize_t)total;
+        }
+
+        /**
+         * Reads up to, and including, the first occurrence of `delimiter` into the given membuf.
+         *
+         * @param delimiter The byte to stop at.
+         * @param o_mem     The membuf to fill.
+         * @return The amount of bytes read on success (`0` on end of stream); `-errno` otherwise.
+         */
+        inline ssize_t ReadUntil(unsigned char delimiter, membuf o_mem)
+        {
+            return ReadUntil(delimiter, o_mem.buffer, o_mem.length);
+        }
+
+        /**
+         * @return The amount of buffered bytes that were not yet consumed.
+         */
+        inline size_t GetBufferedLength() const
+        {
+            return m_end - m_start;
+        }
+
+        /**
+         * @return The size of the internal buffer.
+         */
+        constexpr size_t Capacity() const
+        {
+            return N;
+        }
+
+    private:
+        BufferedReader(const BufferedReader &) = delete;
+
+        IStream &m_stream;
+        size_t m_start;
+        size_t m_end;
+        unsigned char m_buffer[N];
+    };
+}
+
+#endif //KRAKEN_BUFFEREDSTREAM_H
@@ -0,0 +1,383 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file ControlMessage.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_CONTROLMESSAGE_H
+#define KRAKEN_CONTROLMESSAGE_H
+
+#include <Kraken/Definitions.h>
+#include <Kraken/membuf.h>
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/socket.h>
+
+namespace Kraken
+{
+    /**
+     * The buffer space taken by a control message that carries `Count` values of type `T`.
+     * Meant for sizing a `ControlBuffer`, e.g. `ControlBuffer<ControlSpace<int, 4>::value>`.
+     */
+    template <typename T, size_t Count = 1>
+    struct ControlSpace
+    {
+        static constexpr size_t value = CMSG_SPACE(sizeof(T) * Count);
+    };
+
+    /**
+     * A view of a single control (ancillary) message, as found in a received control buffer.
+     */
+    class ControlMessage
+    {
+    public:
+        ControlMessage(const unsigned char *record) : m_record(record) {}
+
+        /**
+         * @return The protocol level of the message (`SOL_SOCKET`, `SOL_IP`, ...).
+         */
+        inline int GetLevel() const
+        {
+            return Field<int>(offsetof(struct cmsghdr, cmsg_level));
+        }
+
+        /**
+         * @return The type of the message (`SCM_RIGHTS`, `SO_TIMESTAMPNS`, ...).
+         */
+        inline int GetType() const
+        {
+            return Field<int>(offsetof(struct cmsghdr, cmsg_type));
+        }
+
+        /**
+         * @return `true` if the message is of the given level and type.
+         */
+        inline bool Is(int level, int type) const
+        {
+            return (GetLevel() == level) && (GetType() == type);
+        }
+
+        /**
+         * @return The payload of the message.
+         */
+        inline const_membuf GetData() const
+        {
+            return const_membuf(m_record + CMSG_LEN(0),
+                                Field<size_t>(offsetof(struct cmsghdr, cmsg_len)) - CMSG_LEN(0));
+        }
+
+        /**
+         * Copies the payload of the message into a value. The payload need not be aligned.
+         *
+         * @param o_value   Filled with the payload.
+         * @return `true` on success; `false` if the payload is smaller than `T`.
+         */
+        template <typename T>
+        inline bool Get(T &o_value) const
+        {
+            const_membuf data = GetData();
+
+            if (data.length < sizeof(T))
+            {
+                return false;
+            }
+
+            memcpy(&o_value, data.buffer, sizeof(T));
+            return true;
+        }
+
+        /**
+         * Copies a payload made of consecutive `T` values.
+         *
+         * @param o_values  Filled with the values.
+         * @param count     The capacity of `o_values`.
+         * @return The amount of values copied.
+         */
+        template <typename T>
+        size_t GetArray(T *o_values, size_t count) const
+        {
+            const_membuf data = GetData();
+            size_t available = data.length / sizeof(T);
+
+            if (count > available)
+            {
+                count = available;
+            }
+
+            memcpy(o_values, data.buffer, count * sizeof(T));
+            return count;
+        }
+
+    private:
+        template <typename T>
+        inline T Field(size_t offset) const
+        {
+            T value;
+            memcpy(&value, m_record + offset, sizeof(value));
+            return value;
+        }
+
+        const unsigned char *m_record;
+    };
+
+    /**
+     * The control messages of a received message, iterable with a range-based for loop.
+     */
+    class ControlMessages
+    {
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(const unsigned char *position, const unsigned char *end) :
+                    m_position(position),
+                    m_end(end)
+            {
+                Validate();
+            }
+
+            inline ControlMessage operator *() const
+            {
+                return ControlMessage(m_position);
+            }
+
+            inline Iterator &operator ++()
+            {
+                struct cmsghdr header;
+
+                memcpy(&header, m_position, sizeof(header));
+
+                // The kernel doesn't pad the last record, so its aligned length may overrun the buffer.
+                if (CMSG_ALIGN(header.cmsg_len) >= (size_t)(m_end - m_position))
+                {
+                    m_position = m_end;
+                    return *this;
+                }
+
+                m_position += CMSG_ALIGN(header.cmsg_len);
+                Validate();
+
+                return *this;
+            }
+
+            inline bool operator !=(const Iterator &other) const
+            {
+                return m_position != other.m_position;
+            }
+
+        private:
+            /**
+             * Stops at a truncated or malformed record.
+             */
+            void Validate()
+            {
+                struct cmsghdr header;
+
+                if ((size_t)(m_end - m_position) < sizeof(header))
+                {
+                    m_position = m_end;
+                    return;
+                }
+
+                memcpy(&header, m_position, sizeof(header));
+                if ((header.cmsg_len < CMSG_LEN(0)) || (header.cmsg_len > (size_t)(m_end - m_position)))
+                {
+                    m_position = m_end;
+                }
+            }
+
+            const unsigned char *m_position;
+            const unsigned char *m_end;
+        };
+
+        ControlMessages() :
+                m_start(nullptr),
+                m_end(nullptr)
+        {}
+
+        ControlMessages(const void *buffer, size_t length) :
+                m_start((const unsigned char *)buffer),
+                m_end((const unsigned char *)buffer + length)
+        {}
+
+        inline Iterator begin() const
+        {
+            return Iterator(m_start, m_end);
+        }
+
+        inline Iterator end() const
+        {
+            return Iterator(m_end, m_end);
+        }
+
+        /**
+         * @return `true` if there are no control messages.
+         */
+        inline bool IsEmpty() const
+        {
+            return !(begin() != end());
+        }
+
+    private:
+        const unsigned char *m_start;
+        const unsigned char *m_end;
+    };
+
+    /**
+     * A fixed-size buffer of control (ancillary) messages.
+     * Messages are appended with `Add` before a send, or the buffer is filled by a receive.
+     *
+     * @tparam N    The capacity of the buffer, in bytes. Use `ControlSpace` to compute it.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <size_t N>
+    class ControlBuffer
+    {
+        static_assert(N >= CMSG_SPACE(0), "N is too small for a control message.");
+
+    public:
+        ControlBuffer() :
+                m_length(0)
+        {
+            memset(m_data, 0, sizeof(m_data));
+        }
+
+        /**
+         * Appends a control message.
+         *
+         * @param level     The protocol level of the message.
+         * @param type      The type of the message.
+         * @param data      The payload of the message.
+         * @param length    The length of the payload, in bytes.
+         * @return `0` on success; `-ENOBUFS` if the buffer is full.
+         */
+        int Add(int level, int type, const void *data, size_t length)
+        {
+            struct cmsghdr header;
+
+            if (CMSG_SPACE(length) > N - m_length)
+            {
+                return -ENOBUFS;
+            }
+
+            memset(&header, 0, sizeof(header));
+            header.cmsg_level = level;
+            header.cmsg_type = type;
+            header.cmsg_len = CMSG_LEN(length);
+
+            memset(m_data + m_length, 0, CMSG_SPACE(length));
+            memcpy(m_data + m_length, &header, sizeof(header));
+            memcpy(m_data + m_length + CMSG_LEN(0), data, length);
+            m_length += CMSG_SPACE(length);
+
+            return 0;
+        }
+
+        /**
+         * Appends a control message that carries a single value.
+         */
+        template <typename T>
+        inline int Add(int level, int type, const T &value)
+        {
+            return Add(level, type, &value, sizeof(value));
+        }
+
+        /**
+         * Appends a control message that carries consecutive values.
+         */
+        template <typename T>
+        inline int AddArray(int level, int type, const T *values, size_t count)
+        {
+            return Add(level, type, values, count * sizeof(T));
+        }
+
+        /**
+         * Removes all of the messages.
+         */
+        inline void Clear()
+        {
+            m_length = 0;
+        }
+
+        /**
+         * @return The messages in the buffer.
+         */
+        inline ControlMessages GetMessages() const
+        {
+            return ControlMessages(m_data, m_length);
+        }
+
+        /**
+         * @return The start of the buffer.
+         */
+        inline void *GetData()
+        {
+            return m_data;
+        }
+
+        /**
+         * @return The start of the buffer.
+         */
+        inline const void *GetData() const
+        {
+            return m_data;
+        }
+
+        /**
+         * @return The amount of bytes used by messages.
+         */
+        inline size_t GetLength() const
+        {
+            return m_length;
+        }
+
+        /**
+         * Sets the amount of bytes used by messages, after the buffer was filled by a receive.
+         */
+        inline void SetLength(size_t length)
+        {
+            m_length = (length < N) ? length : N;
+        }
+
+        /**
+         * @return The capacity of the buffer.
+         */
+        constexpr size_t Capacity() const
+        {
+            return N;
+        }
+
+    private:
+        ControlBuffer(const ControlBuffer &) = delete;
+
+        alignas(struct cmsghdr) unsigned char m_data[N];
+        size_t m_length;
+    };
+}
+
+#endif //KRAKEN_CONTROLMESSAGE_H
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file Directory.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_DIRECTORY_H
+#define KRAKEN_DIRECTORY_H
+
+#include <Kraken/IO/File.h>
+#include <dirent.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace Kraken
+{
+    /**
+     * The type of a directory entry, as reported by the file system.
+     */
+    enum class EEntryType
+    {
+        /**
+         * The file system doesn't report types; `stat` the entry to find out.
+         */
+        Unknown = DT_UNKNOWN,
+        File = DT_REG,
+        Directory = DT_DIR,
+        SymbolicLink = DT_LNK,
+        Fifo = DT_FIFO,
+        Socket = DT_SOCK,
+        CharacterDevice = DT_CHR,
+        BlockDevice = DT_BLK,
+    };
+
+    /**
+     * A view of a single entry inside a buffer filled by `Directory::ReadEntries`.
+     */
+    class DirectoryEntry
+    {
+    public:
+        DirectoryEntry(const unsigned char *record) : m_record(record) {}
+
+        /**
+         * @return The null-terminated name of the entry. Points into the entries buffer.
+         */
+        inline const char *GetName() const
+        {
+            return (const char *)m_record + offsetof(struct dirent64, d_name);
+        }
+
+        /**
+         * @return The inode number of the entry.
+         */
+        inline ino64_t GetInode() const
+        {
+            ino64_t inode;
+
+            // The caller's buffer need not be aligned for `dirent64`.
+            memcpy(&inode, m_record + offsetof(struct dirent64, d_ino), sizeof(inode));
+            return inode;
+        }
+
+        /**
+         * @return The type of the entry.
+         */
+        inline EEntryType GetType() const
+        {
+            return (EEntryType)m_record[offsetof(struct dirent64, d_type)];
+        }
+
+        /**
+         * @return `true` if the entry is `.` or `..`.
+         */
+        inline bool IsSelfOrParent() const
+        {
+            const char *name = GetName();
+            return (name[0] == '.') && ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0')));
+        }
+
+    private:
+        const unsigned char *m_record;
+    };
+
+    /**
+     * A batch of directory entries read by `Directory::ReadEntries`, iterated in place.
+     */
+    class DirectoryEntries
+    {
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(const unsigned char *position) : m_position(position) {}
+
+            inline DirectoryEntry operator *() const
+            {
+                return DirectoryEntry(m_position);
+            }
+
+            inline Iterator &operator ++()
+            {
+                unsigned short recordLength;
+
+                memcpy(&recordLength, m_position + offsetof(struct dirent64, d_reclen), sizeof(recordLength));
+                m_position += recordLength;
+
+                return *this;
+            }
+
+            inline bool operator !=(const Iterator &other) const
+            {
+                return m_position != other.m_position;
+            }
+
+        private:
+            const unsigned char *m_position;
+        };
+
+        DirectoryEntries() :
+                m_start(nullptr),
+                m_end(nullptr)
+        {}
+
+        DirectoryEntries(const void *buffer, size_t length) :
+                m_start((const unsigned char *)buffer),
+                m_end((const unsigned char *)buffer + length)
+        {}
+
+        inline Iterator begin() const
+        {
+            return Iterator(m_start);
+        }
+
+        inline Iterator end() const
+        {
+            return Iterator(m_end);
+        }
+
+        /**
+         * @return `true` if the batch contains no entries.
+         */
+        inline bool IsEmpty() const
+        {
+            return m_start == m_end;
+        }
+
+    private:
+        const unsigned char *m_start;
+        const unsigned char *m_end;
+    };
+
+    /**
+     * A directory, read in batches of raw entries (`getdents64`) without per-entry allocations or `stat`s.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class Directory : public File
+    {
+    public:
+        Directory() {}
+
+        Directory(fd_t descriptor) : File(descriptor) {}
+
+        /**
+         * Opens a directory for reading.
+         *
+         * @param path  The path of the directory.
+         * @param flags Additional flags. `EFileFlags::Read` and `EFileFlags::Directory` are always added.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(const char *path, EFileFlags flags = EFileFlags::CloseOnExec);
+
+        /**
+         * Reads the next batch of entries.
+         *
+         * @param o_buffer  The buffer to fill with entries. Should be at least a few kilobytes.
+         * @param o_entries After a successful call, will contain a view of the entries in `o_buffer`.
+         *
+         * @return The amount of bytes filled on success (`0` once all entries were read);
+         *          `-EINVAL` if the buffer is too small for a single entry; `-errno` on error.
+         */
+        ssize_t ReadEntries(membuf o_buffer, DirectoryEntries &o_entries);
+
+        /**
+         * Restarts the reading of entries from the beginning of the directory.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Rewind();
+
+        /**
+         * Opens a file in this directory.
+         *
+         * @param o_child   The file to open. Must not be open.
+         * @param name      The name of the file, relative to this directory.
+         * @param flags     Flags controlling the opening-mode of the file.
+         * @param mode      Optional file permission mask. Used when creating a file.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        inline int OpenChild(File &o_child, const char *name, EFileFlags flags,
+                             EFileModes mode = EFileModes::Default) const
+        {
+            return o_child.OpenAt(*this, name, flags, mode);
+        }
+
+        /**
+         * Opens a file in this directory, with restricted path resolution.
+         *
+         * @param o_child   The file to open. Must not be open.
+         * @param name      The name of the file, relative to this directory.
+         * @param flags     Flags controlling the opening-mode of the file.
+         * @param resolve   Restrictions on the resolution of `name`.
+         * @param mode      Optional file permission mask. Used when creating a file.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        inline int OpenChild(File &o_child, const char *name, EFileFlags flags, EResolveFlags resolve,
+                             EFileModes mode = EFileModes::Default) const
+        {
+            return o_child.OpenAt(*this, name, flags, resolve, mode);
+        }
+
+        /**
+         * Removes a file (`unlinkat`) or an empty directory from this directory.
+         *
+         * @param name          The name of the entry, relative to this directory.
+         * @param isDirectory   Whether the entry is a directory.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int RemoveChild(const char *name, bool isDirectory = false);
+
+    private:
+        Directory(const Directory &) = delete;
+    };
+}
+
+#endif //KRAKEN_DIRECTORY_H
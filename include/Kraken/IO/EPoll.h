@@ -32,6 +32,7 @@
 #include <Kraken/Collections.h>
 #include <sys/epoll.h>
 #include <errno.h>
+#include <unistd.h>
 namespace Kraken
 {
     /**
@@ -50,6 +51,11 @@ namespace Kraken
         {
         }
 
+        virtual ~EPoll()
+        {
+            Close();
+        }
+
         /**
          * Tries to open a new EPoll object.
          *
@@ -155,6 +161,26 @@ namespace Kraken
             return Wait((typename array<T *, N>::native_array_ref)o_events, timeout);
         }
 
+        /**
+         * @return `true` if the object holds an epoll instance.
+         */
+        inline bool IsOpen() const
+        {
+            return m_descriptor >= 0;
+        }
+
+        /**
+         * Closes the epoll instance, if it is open.
+         */
+        void Close()
+        {
+            if (IsOpen())
+            {
+                close(m_descriptor);
+                m_descriptor = -EBADFD;
+            }
+        }
+
         /**
          * @return The object's underlying file descriptor.
          */
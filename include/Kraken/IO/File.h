@@ -36,6 +36,23 @@
 #include <sys/stat.h>
 #include <sys/uio.h>
 
+#ifndef KRAKEN_OPT_DISABLE_OPENAT2
+#include <linux/openat2.h>
+#endif
+
+// Kernel headers older than `openat2` (5.6) lack these; the values are part of the kernel's ABI.
+#ifndef RESOLVE_NO_XDEV
+#define RESOLVE_NO_XDEV         0x01
+#define RESOLVE_NO_MAGICLINKS   0x02
+#define RESOLVE_NO_SYMLINKS     0x04
+#define RESOLVE_BENEATH         0x08
+#define RESOLVE_IN_ROOT         0x10
+#endif
+
+#ifndef RESOLVE_CACHED
+#define RESOLVE_CACHED          0x20
+#endif
+
 namespace Kraken
 {
     /**
@@ -150,8 +167,180 @@ namespace Kraken
         Default = UserRead | UserWrite | GroupRead | OthersRead
     };
 
+    /**
+     * Per-call flags for positional vector IO (`preadv2`/`pwritev2`).
+     */
+    enum class ERWFlags
+    {
+        None = 0,
+
+        /**
+         * High priority request; poll if possible.
+         */
+        HighPriority = RWF_HIPRI,
+
+        /**
+         * Per-call equivalent of `EFileFlags::DataSync`.
+         */
+        DataSync = RWF_DSYNC,
+
+        /**
+         * Per-call equivalent of `EFileFlags::Sync`.
+         */
+        Sync = RWF_SYNC,
+
+        /**
+         * Fail with `-EAGAIN` instead of blocking; e.g. a read of data that is not in the page cache.
+         */
+        NoWait = RWF_NOWAIT,
+
+        /**
+         * Per-call equivalent of `EFileFlags::Append`. The offset is ignored.
+         */
+        Append = RWF_APPEND,
+    };
+
+    /**
+     * Space allocation modes for `File::Allocate`.
+     */
+    enum class EAllocateFlags
+    {
+        /**
+         * Allocate the range, and extend the file if the range ends past its end.
+         */
+        None = 0,
+
+        /**
+         * Allocate the range, but do not change the file size.
+         */
+        KeepSize = FALLOC_FL_KEEP_SIZE,
+
+        /**
+         * Deallocate the range. Must be combined with `KeepSize`.
+         */
+        PunchHole = FALLOC_FL_PUNCH_HOLE,
+
+        /**
+         * Zero the range, allocating it if needed.
+         */
+        ZeroRange = FALLOC_FL_ZERO_RANGE,
+
+        /**
+         * Remove the range from the file, shifting the rest of it backwards.
+         */
+        CollapseRange = FALLOC_FL_COLLAPSE_RANGE,
+
+        /**
+         * Insert a hole at the range, shifting the rest of the file forward.
+         */
+        InsertRange = FALLOC_FL_INSERT_RANGE,
+    };
+
+    /**
+     * The expected access pattern of a file region, given to `File::Advise`.
+     */
+    enum class EAdvice
+    {
+        Normal = POSIX_FADV_NORMAL,
+        Sequential = POSIX_FADV_SEQUENTIAL,
+        Random = POSIX_FADV_RANDOM,
+        NoReuse = POSIX_FADV_NOREUSE,
+        WillNeed = POSIX_FADV_WILLNEED,
+        DontNeed = POSIX_FADV_DONTNEED,
+    };
+
+    /**
+     * Flags controlling `File::SyncRange`.
+     */
+    enum class ESyncRangeFlags
+    {
+        None = 0,
+
+        /**
+         * Wait for writeback of pages in the range that was already started.
+         */
+        WaitBefore = SYNC_FILE_RANGE_WAIT_BEFORE,
+
+        /**
+         * Start writeback of the dirty pages in the range.
+         */
+        Write = SYNC_FILE_RANGE_WRITE,
+
+        /**
+         * Wait for the writeback of the range to finish.
+         */
+        WaitAfter = SYNC_FILE_RANGE_WAIT_AFTER,
+    };
+
+    /**
+     * Restrictions on the path resolution of `File::OpenAt` (`openat2`).
+     */
+    enum class EResolveFlags
+    {
+        None = 0,
+
+        /**
+         * Fail if the resolution crosses a mount point.
+         */
+        NoCrossDevice = RESOLVE_NO_XDEV,
+
+        /**
+         * Fail on procfs-style "magic" links.
+         */
+        NoMagicLinks = RESOLVE_NO_MAGICLINKS,
+
+        /**
+         * Fail on any symbolic link.
+         */
+        NoSymbolicLinks = RESOLVE_NO_SYMLINKS,
+
+        /**
+         * Fail if the path escapes the directory (absolute paths, `..`, or links pointing outside).
+         */
+        Beneath = RESOLVE_BENEATH,
+
+        /**
+         * Resolve the path as if the directory was the root of the file system.
+         */
+        InRoot = RESOLVE_IN_ROOT,
+
+        /**
+         * Fail with `-EAGAIN` instead of blocking, if the resolution isn't fully cached.
+         * Makes a cheap, non-blocking first attempt possible from an event loop.
+         */
+        Cached = RESOLVE_CACHED,
+    };
+
+    /**
+     * Flags controlling `File::Splice`.
+     */
+    enum class ESpliceFlags
+    {
+        None = 0,
+
+        /**
+         * Hint to move pages instead of copying them.
+         */
+        Move = SPLICE_F_MOVE,
+
+        /**
+         * Don't block on the pipe. The other file may still block, unless it is non-blocking itself.
+         */
+        NonBlock = SPLICE_F_NONBLOCK,
+
+        /**
+         * More data will follow (like `MSG_MORE`).
+         */
+        More = SPLICE_F_MORE,
+    };
+
     ENUM_FLAGS(EFileFlags);
     ENUM_FLAGS(EFileModes);
+    ENUM_FLAGS(ESpliceFlags);
+    ENUM_FLAGS(EResolveFlags);
+    ENUM_FLAGS(ERWFlags);
+    ENUM_FLAGS(EAllocateFlags);
+    ENUM_FLAGS(ESyncRangeFlags);
 
     /**
      * A basic POSIX file wrapper.
@@ -169,7 +358,15 @@ namespace Kraken
         /**
          * Construct a default, non-open instance.
          */
-        File() : m_descriptor(-EBADFD) { }
+        File() :
+                m_descriptor(-EBADFD),
+#ifndef NDEBUG
+                m_directIODescriptor(-EBADFD),
+                m_directIOMemoryAlignment(0),
+                m_directIOOffsetAlignment(0),
+#endif
+                m_isUnpublishedName(false)
+        { }
 
         /**
          * Construct an instance around an open-file descriptor.
@@ -179,7 +376,15 @@ namespace Kraken
          *
          * @param descriptor The file descriptor to use.
          */
-        File(int descriptor) : m_descriptor(descriptor < 0 ? -EBADFD : descriptor) {}
+        File(int descriptor) :
+                m_descriptor(descriptor < 0 ? -EBADFD : descriptor),
+#ifndef NDEBUG
+                m_directIODescriptor(-EBADFD),
+                m_directIOMemoryAlignment(0),
+                m_directIOOffsetAlignment(0),
+#endif
+                m_isUnpublishedName(false)
+        {}
 
         virtual ~File()
         {
@@ -202,6 +407,63 @@ namespace Kraken
          */
         int Open(const char *path, EFileFlags flags, EFileModes mode = EFileModes::Default);
 
+        /**
+         * Opens a file relative to an open directory (`openat`).
+         *
+         * @param directory The directory `path` is relative to.
+         * @param path      The name of the file. An absolute path ignores `directory`.
+         * @param flags     Flags controlling the opening-mode of the file.
+         * @param mode      Optional file permission mask. Used when creating a file.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int OpenAt(const File &directory, const char *path, EFileFlags flags, EFileModes mode = EFileModes::Default);
+
+        /**
+         * Opens a file relative to an open directory, with restricted path resolution (`openat2`).
+         *
+         * @param directory The directory `path` is relative to.
+         * @param path      The name of the file.
+         * @param flags     Flags controlling the opening-mode of the file.
+         * @param resolve   Restrictions on the resolution of `path`.
+         * @param mode      Optional file permission mask. Used when creating a file.
+         *
+         * @return `0` on success; `-EAGAIN` if `EResolveFlags::Cached` was given and the resolution would block;
+         *          `-EXDEV` or `-ELOOP` if the resolution was restricted; `-errno` on error.
+         */
+        int OpenAt(const File &directory, const char *path, EFileFlags flags, EResolveFlags resolve,
+                   EFileModes mode = EFileModes::Default);
+
+        /**
+         * Creates an unnamed, read-write file in the given directory (`O_TMPFILE`).
+         * The file disappears when closed, unless it is given a name with `Publish`.
+         *
+         * When the file system doesn't support `O_TMPFILE`, a uniquely named file (`.kraken-XXXXXX`)
+         * is created in the directory instead; `Publish` renames it into place, and `Close` removes it
+         * if it was never published.
+         *
+         * @param directory The directory to create the file in. Must be on the same file system
+         *                  as the path it will be published to.
+         * @param mode      The permissions the file is published with.
+         *                  The fallback applies them as-is, without the process's umask.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int OpenTemporary(const char *directory, EFileModes mode = EFileModes::Default);
+
+        /**
+         * Atomically places the file at `path`, replacing any existing file.
+         *
+         * An unnamed file is linked under a temporary name next to `path` and renamed over it;
+         * a named file is renamed. Either way, readers of `path` see either the old file or the new one.
+         *
+         * @param path  The path to publish the file at.
+         * @param sync  Whether to make the data durable before publishing, and the new name durable after.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Publish(const char *path, bool sync = false);
+
         /**
          * Read up to `length` bytes from the file into `o_buffer`.
          *
@@ -242,6 +504,36 @@ namespace Kraken
             return ReadAt(o_mem.buffer, o_mem.length, offset);
         }
 
+        /**
+         * Read from an offset in the file, with per-call flags.
+         *
+         * @param o_buffer  The buffer to read into.
+         * @param length    The length of the buffer.
+         * @param offset    The starting-offset of the read. `-1` to use (and update) the current file offset.
+         * @param flags     Per-call flags.
+         *
+         * @note The function may return a valid-value that is smaller than `length`.
+         *
+         * @return  The number of bytes read on success; `-errno` on error.
+         */
+        ssize_t ReadAt(void *o_buffer, size_t length, off_t offset, ERWFlags flags);
+
+        /**
+         * Read from an offset in the file into the given membuf, with per-call flags.
+         *
+         * @param o_mem     The membuf to fill with data.
+         * @param offset    The starting offset of the read. `-1` to use (and update) the current file offset.
+         * @param flags     Per-call flags.
+         *
+         * @note The function may return a valid-value that is smaller than the length of the membuf.
+         *
+         * @return  The number of bytes read on success; `-errno` on error.
+         */
+        inline ssize_t ReadAt(membuf o_mem, off_t offset, ERWFlags flags)
+        {
+            return ReadAt(o_mem.buffer, o_mem.length, offset, flags);
+        }
+
         /**
          * Read data from the file into multiple buffers.
          *
@@ -277,6 +569,25 @@ namespace Kraken
             return Read(nativeVectors, N, offset);
         }
 
+        /**
+         * Read data from the file into multiple buffers, with per-call flags.
+         *
+         * @tparam N    The number of vectors.
+         *
+         * @param vectors   The buffers to read to.
+         * @param offset    The statring offset of the operation. `-1` to use (and update) the current file offset.
+         * @param flags     Per-call flags.
+         * @return On success, the total amount of bytes read; `-errno` on error.
+         */
+        template <size_t N>
+        inline ssize_t Read(membuf (&vectors)[N], off_t offset, ERWFlags flags)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return Read(nativeVectors, N, offset, flags);
+        }
+
         /**
          * Write data from multiple buffers into the file.
          *
@@ -312,6 +623,25 @@ namespace Kraken
             return Write(nativeVectors, N, offset);
         }
 
+        /**
+         * Write data from multiple buffers into the file, with per-call flags.
+         *
+         * @tparam N    The number of vectors.
+         *
+         * @param vectors   The vectors to write.
+         * @param offset    The statring offset of the operation. `-1` to use (and update) the current file offset.
+         * @param flags     Per-call flags.
+         * @return On success, the total amount of bytes written; `-errno` on error.
+         */
+        template <size_t N>
+        inline ssize_t Write(const_membuf (&vectors)[N], off_t offset, ERWFlags flags)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return Write(nativeVectors, N, offset, flags);
+        }
+
         /**
          * Write the given buffer to the file.
          *
@@ -352,6 +682,36 @@ namespace Kraken
             return WriteAt(mem.buffer, mem.length, offset);
         }
 
+        /**
+         * Write the given buffer to the file at an offset, with per-call flags.
+         *
+         * @param buffer    The buffer containing the data to write.
+         * @param length    The size of the buffer, in bytes.
+         * @param offset    The starting offset of the write. `-1` to use (and update) the current file offset.
+         * @param flags     Per-call flags.
+         *
+         * @note The function may return a valid-value that is smaller than `length`.
+         *
+         * @return The amount of bytes written on success; `-errno` otherwise.
+         */
+        ssize_t WriteAt(const void *buffer, size_t length, off_t offset, ERWFlags flags);
+
+        /**
+         * Write the given membuf to the file at an offset, with per-call flags.
+         *
+         * @param mem       The membuf to write.
+         * @param offset    The starting offset of the write. `-1` to use (and update) the current file offset.
+         * @param flags     Per-call flags.
+         *
+         * @note The function may return a valid-value that is smaller than the length of the membuf.
+         *
+         * @return The amount of bytes written on success; `-errno` otherwise.
+         */
+        inline ssize_t WriteAt(const_membuf mem, off_t offset, ERWFlags flags)
+        {
+            return WriteAt(mem.buffer, mem.length, offset, flags);
+        }
+
         /**
          * Device independent IO control.
          *
@@ -362,6 +722,120 @@ namespace Kraken
          */
         int IOControl(unsigned long command, void *parameter);
 
+        /**
+         * Manipulates the allocated disk space of a file region.
+         * With the default flags, the region is preallocated and the file is extended to cover it.
+         *
+         * @param offset    The start of the region.
+         * @param length    The length of the region, in bytes.
+         * @param flags     The allocation mode.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Allocate(off_t offset, off_t length, EAllocateFlags flags = EAllocateFlags::None);
+
+        /**
+         * Changes the size of the file (`ftruncate`).
+         * Data past the new size is discarded; growing the file fills the new space with zeros.
+         *
+         * @param length    The new size of the file, in bytes.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Truncate(off_t length);
+
+        /**
+         * Announces the expected access pattern of a file region, so the kernel can tune caching and readahead.
+         *
+         * @param advice    The expected access pattern.
+         * @param offset    The start of the region.
+         * @param length    The length of the region. `0` means until the end of the file.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Advise(EAdvice advice, off_t offset = 0, off_t length = 0);
+
+        /**
+         * Populates the page cache with a file region, blocking until it is read.
+         *
+         * @param offset    The start of the region.
+         * @param count     The length of the region, in bytes.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Readahead(off_t offset, size_t count);
+
+        /**
+         * Controls the writeback of a file region.
+         *
+         * @note This does not flush the file metadata or the disk cache, and so promises no durability.
+         *          Use it to start writeback early, and `Sync`/`DataSync` to make data durable.
+         *
+         * @param offset    The start of the region.
+         * @param length    The length of the region. `0` means until the end of the file.
+         * @param flags     Which writeback stages to start and wait for.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int SyncRange(off_t offset, off_t length, ESyncRangeFlags flags = ESyncRangeFlags::Write);
+
+        /**
+         * Flushes the data and metadata of the file to the storage device (`fsync`).
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Sync();
+
+        /**
+         * Flushes the data of the file to the storage device, along with just the metadata
+         * needed to read it back (`fdatasync`).
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int DataSync();
+
+        /**
+         * Resizes the buffer of a pipe (`F_SETPIPE_SZ`).
+         * The kernel rounds the capacity up to a power-of-two number of pages.
+         *
+         * @param capacity  The requested capacity, in bytes.
+         *
+         * @return `0` on success; `-EPERM` if the capacity exceeds the system limit for unprivileged users;
+         *          `-EBUSY` if the pipe holds more data than the new capacity; `-errno` on error.
+         */
+        int SetPipeCapacity(size_t capacity);
+
+        /**
+         * Queries the buffer size of a pipe (`F_GETPIPE_SZ`).
+         *
+         * @param o_capacity    After a successful call, will contain the capacity of the pipe, in bytes.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int GetPipeCapacity(size_t &o_capacity);
+
+        /**
+         * Queries the amount of bytes that can be read without blocking (`FIONREAD`).
+         * Supported by pipes, sockets and terminals.
+         *
+         * @param o_length  After a successful call, will contain the amount of readable bytes.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int GetPendingLength(size_t &o_length);
+
+        /**
+         * Queries the alignment direct IO (`EFileFlags::Direct`) requires for file offsets and transfer lengths.
+         *
+         * Uses `statx` when the file system reports its direct IO alignment, and falls back to the logical
+         * sector size (`BLKSSZGET`) for block devices. For regular files, older kernels fall back to
+         * the logical block size of the file system's device, or to the file system's block size.
+         *
+         * @param o_blockSize   After a successful call, will contain the logical block size, in bytes.
+         * @return `0` on success; `-errno` on error. (`-EOPNOTSUPP` if the file does not support direct IO)
+         */
+        int GetLogicalBlockSize(size_t &o_blockSize);
+
         /**
          * Closes the file.
          */
@@ -375,7 +849,7 @@ namespace Kraken
          *
          * @return `true` if the file contains a valid descriptor.
          */
-        inline bool IsOpen()
+        inline bool IsOpen() const
         {
             return (m_descriptor > 0);
         }
@@ -388,6 +862,25 @@ namespace Kraken
             return m_descriptor;
         }
 
+        /**
+         * Gives up the ownership of the underlying descriptor; the object is left closed,
+         * and the caller becomes responsible for closing the descriptor (and removing an unpublished
+         * temporary file's name).
+         *
+         * @return The descriptor.
+         */
+        inline fd_t Detach()
+        {
+            fd_t descriptor = m_descriptor;
+
+            m_descriptor = -EBADFD;
+#ifndef NDEBUG
+            m_directIODescriptor = -EBADFD;
+#endif
+            m_isUnpublishedName = false;
+            return descriptor;
+        }
+
     public:
         /**
          * Creates a new uni-directional pipe and places its ends in the given `File`s.
@@ -402,18 +895,81 @@ namespace Kraken
          */
         static int Pipe(File &o_readEnd, File &o_writeEnd, EFileFlags flags = EFileFlags::None);
 
+        /**
+         * Moves data between two files without copying it through userspace (`splice`).
+         * At least one of the files must be a pipe.
+         *
+         * @param input     The file to read from.
+         * @param output    The file to write to.
+         * @param length    The maximal amount of bytes to move.
+         * @param flags     Splicing flags.
+         *
+         * @return The amount of bytes moved on success (`0` at the end of the input); `-errno` on error.
+         */
+        static ssize_t Splice(File &input, File &output, size_t length, ESpliceFlags flags = ESpliceFlags::None);
+
     protected:
+        /**
+         * Hands an open descriptor to a closed file object (e.g. one received over a Unix socket).
+         */
+        static inline void Adopt(File &o_file, fd_t descriptor)
+        {
+            o_file.m_descriptor = descriptor;
+#ifndef NDEBUG
+            o_file.m_directIODescriptor = -EBADFD;
+#endif
+            o_file.m_isUnpublishedName = false;
+        }
+
         /**
          * Holds the OS handle to the open file.
          */
         fd_t m_descriptor;
 
     private:
+        /**
+         * Queries the direct IO memory and offset alignment requirements.
+         */
+        int GetDirectIOAlignment(size_t &o_memoryAlignment, size_t &o_offsetAlignment);
+
+#ifndef NDEBUG
+        /**
+         * Checks the alignment of a positional transfer if the file is open for direct IO.
+         * Only used in debug builds.
+         *
+         * @return `0` if the transfer is valid; `-EINVAL` otherwise.
+         */
+        int ValidateDirectIO(const void *buffer, size_t length, off_t offset);
+
+        /**
+         * The descriptor whose direct IO alignment is cached below; queried on its first direct transfer.
+         */
+        fd_t m_directIODescriptor;
+
+        /**
+         * The cached direct IO alignment requirements; `0` if they are unknown.
+         */
+        size_t m_directIOMemoryAlignment;
+        size_t m_directIOOffsetAlignment;
+#endif
+
+        /**
+         * Whether the file is a named `OpenTemporary` fallback that hasn't been published yet.
+         */
+        bool m_isUnpublishedName;
+
+        /**
+         * Removes the name of an unpublished temporary file, if it still refers to the open file.
+         */
+        void RemoveUnpublishedName();
+
         // Internal vector implementations.
         ssize_t Read(iovec vectors[], size_t vectorCount);
         ssize_t Read(iovec vectors[], size_t vectorCount, off_t offset);
         ssize_t Write(iovec vectors[], size_t vectorCount);
         ssize_t Write(iovec vectors[], size_t vectorCount, off_t offset);
+        ssize_t Read(iovec vectors[], size_t vectorCount, off_t offset, ERWFlags flags);
+        ssize_t Write(iovec vectors[], size_t vectorCount, off_t offset, ERWFlags flags);
 
         /**
          * Deleted to disallow duplicating the file.
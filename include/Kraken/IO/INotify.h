@@ -0,0 +1,376 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file INotify.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_INOTIFY_H
+#define KRAKEN_INOTIFY_H
+
+#include <Kraken/IO/IEPollable.h>
+#include <Kraken/membuf.h>
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/inotify.h>
+
+namespace Kraken
+{
+    /**
+     * Possible INotify initialization flags.
+     */
+    enum class EINotifyFlags
+    {
+        None = 0,
+        CloseOnExec = IN_CLOEXEC,
+        NonBlock = IN_NONBLOCK,
+    };
+
+    /**
+     * The events a watch reports, options for adding a watch, and flags that only appear in reported events.
+     */
+    enum class EINotifyEvents : uint32_t
+    {
+        None = 0,
+
+        Access = IN_ACCESS,
+        Modify = IN_MODIFY,
+        AttributesChanged = IN_ATTRIB,
+        CloseWrite = IN_CLOSE_WRITE,
+        CloseNoWrite = IN_CLOSE_NOWRITE,
+        Open = IN_OPEN,
+        MovedFrom = IN_MOVED_FROM,
+        MovedTo = IN_MOVED_TO,
+        Create = IN_CREATE,
+        Delete = IN_DELETE,
+        DeleteSelf = IN_DELETE_SELF,
+        MoveSelf = IN_MOVE_SELF,
+
+        Close = IN_CLOSE,
+        Move = IN_MOVE,
+        All = IN_ALL_EVENTS,
+
+        /**
+         * Only watch the path if it is a directory.
+         */
+        OnlyDirectory = IN_ONLYDIR,
+
+        /**
+         * Don't follow the path if it is a symbolic link.
+         */
+        DontFollow = IN_DONT_FOLLOW,
+
+        /**
+         * Don't report events of children after they were unlinked.
+         */
+        ExcludeUnlinked = IN_EXCL_UNLINK,
+
+        /**
+         * Add the events to an existing watch instead of replacing them.
+         */
+        AddToMask = IN_MASK_ADD,
+
+        /**
+         * Fail with `-EEXIST` if the path is already watched.
+         */
+        CreateOnly = IN_MASK_CREATE,
+
+        /**
+         * Remove the watch after the first event.
+         */
+        OneShot = IN_ONESHOT,
+
+        /**
+         * The watch was removed (explicitly, or because the file was deleted or unmounted).
+         */
+        Ignored = IN_IGNORED,
+
+        /**
+         * The subject of the event is a directory.
+         */
+        IsDirectory = IN_ISDIR,
+
+        /**
+         * The event queue overflowed, and events were lost.
+         */
+        Overflow = IN_Q_OVERFLOW,
+
+        /**
+         * The file system containing the watched object was unmounted.
+         */
+        Unmounted = IN_UNMOUNT,
+    };
+
+    ENUM_FLAGS(EINotifyFlags);
+    ENUM_FLAGS(EINotifyEvents);
+
+    /**
+     * A view of a single event inside a buffer filled by `INotify::ReadEvents`.
+     */
+    class INotifyEvent
+    {
+    public:
+        INotifyEvent(const unsigned char *record) : m_record(record) {}
+
+        /**
+         * @return The watch that reported the event.
+         */
+        inline int GetWatch() const
+        {
+            return Field<int>(offsetof(struct inotify_event, wd));
+        }
+
+        /**
+         * @return The events that occurred.
+         */
+        inline EINotifyEvents GetEvents() const
+        {
+            return (EINotifyEvents)Field<uint32_t>(offsetof(struct inotify_event, mask));
+        }
+
+        /**
+         * @return `true` if any of the given events occurred.
+         */
+        inline bool Is(EINotifyEvents events) const
+        {
+            return (GetEvents() & events) != EINotifyEvents::None;
+        }
+
+        /**
+         * @return The cookie that ties a `MovedFrom` event to its `MovedTo` event; `0` for other events.
+         */
+        inline uint32_t GetCookie() const
+        {
+            return Field<uint32_t>(offsetof(struct inotify_event, cookie));
+        }
+
+        /**
+         * @return `true` if the event is about an entry inside a watched directory.
+         */
+        inline bool HasName() const
+        {
+            return Field<uint32_t>(offsetof(struct inotify_event, len)) > 0;
+        }
+
+        /**
+         * @return The null-terminated name of the entry; an empty string for events on the watched object itself.
+         *          Points into the events buffer.
+         */
+        inline const char *GetName() const
+        {
+            return HasName() ? (const char *)m_record + offsetof(struct inotify_event, name) : "";
+        }
+
+    private:
+        template <typename T>
+        inline T Field(size_t offset) const
+        {
+            T value;
+
+            // The caller's buffer need not be aligned for `inotify_event`.
+            memcpy(&value, m_record + offset, sizeof(value));
+            return value;
+        }
+
+        const unsigned char *m_record;
+    };
+
+    /**
+     * A batch of events read by `INotify::ReadEvents`, iterated in place.
+     */
+    class INotifyEvents
+    {
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(const unsigned char *position) : m_position(position) {}
+
+            inline INotifyEvent operator *() const
+            {
+                return INotifyEvent(m_position);
+            }
+
+            inline Iterator &operator ++()
+            {
+                uint32_t nameLength;
+
+                memcpy(&nameLength, m_position + offsetof(struct inotify_event, len), sizeof(nameLength));
+                m_position += sizeof(struct inotify_event) + nameLength;
+
+                return *this;
+            }
+
+            inline bool operator !=(const Iterator &other) const
+            {
+                return m_position != other.m_position;
+            }
+
+        private:
+            const unsigned char *m_position;
+        };
+
+        INotifyEvents() :
+                m_start(nullptr),
+                m_end(nullptr)
+        {}
+
+        INotifyEvents(const void *buffer, size_t length) :
+                m_start((const unsigned char *)buffer),
+                m_end((const unsigned char *)buffer + length)
+        {}
+
+        inline Iterator begin() const
+        {
+            return Iterator(m_start);
+        }
+
+        inline Iterator end() const
+        {
+            return Iterator(m_end);
+        }
+
+        /**
+         * @return `true` if the batch contains no events.
+         */
+        inline bool IsEmpty() const
+        {
+            return m_start == m_end;
+        }
+
+    private:
+        const unsigned char *m_start;
+        const unsigned char *m_end;
+    };
+
+    /**
+     * File-system event notifications (inotify).
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class INotify : public IEPollable
+    {
+    public:
+        /**
+         * A buffer size that is guaranteed to hold at least one event.
+         */
+        static constexpr size_t s_MinimalBufferSize = sizeof(struct inotify_event) + NAME_MAX + 1;
+
+        INotify() :
+                m_descriptor(-EBADFD)
+        {}
+
+        /**
+         * Constructs an INotify object from an existing, open file descriptor.
+         *
+         * @param descriptor The file descriptor to use.
+         */
+        INotify(fd_t descriptor) :
+                m_descriptor(descriptor >= 0 ? descriptor : -EBADFD)
+        {}
+
+        virtual ~INotify()
+        {
+            if (IsOpen())
+            {
+                Close();
+            }
+        }
+
+        /**
+         * Opens a new inotify instance.
+         *
+         * @param flags Initialization flags.
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(EINotifyFlags flags = EINotifyFlags::CloseOnExec);
+
+        /**
+         * Starts watching a file or a directory.
+         * Watching a path that is already watched modifies the existing watch.
+         *
+         * @param path      The path to watch.
+         * @param events    The events to report, and watch options.
+         * @param o_watch   After a successful call, will contain the watch's identifier.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int AddWatch(const char *path, EINotifyEvents events, int &o_watch);
+
+        /**
+         * Stops watching.
+         * An `EINotifyEvents::Ignored` event is reported for the watch.
+         *
+         * @param watch The watch's identifier.
+         * @return `0` on success; `-errno` on error.
+         */
+        int RemoveWatch(int watch);
+
+        /**
+         * Reads a batch of pending events.
+         * Blocks if there are none, unless the instance was opened with `EINotifyFlags::NonBlock`.
+         *
+         * @param o_buffer  The buffer to fill with events. Should be at least `s_MinimalBufferSize` bytes.
+         * @param o_events  After a successful call, will contain a view of the events in `o_buffer`.
+         *
+         * @return The amount of bytes filled on success; `-EINVAL` if the buffer is too small for the next event;
+         *          `-errno` on error.
+         */
+        ssize_t ReadEvents(membuf o_buffer, INotifyEvents &o_events);
+
+        /**
+         * Indicates whether the object contains a handle that appears to be valid.
+         *
+         * @return `true` if the object contains a valid descriptor.
+         */
+        inline bool IsOpen() const
+        {
+            return (m_descriptor >= 0);
+        }
+
+        /**
+         * Returns the underlying file-descriptor handle.
+         */
+        fd_t GetFileDescriptor() const override final
+        {
+            return m_descriptor;
+        }
+
+        /**
+         * Closes the instance, removing all of its watches.
+         */
+        void Close();
+
+    private:
+        INotify(const INotify &) = delete;
+
+        fd_t m_descriptor;
+    };
+}
+
+#endif //KRAKEN_INOTIFY_H
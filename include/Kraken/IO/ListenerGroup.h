@@ -0,0 +1,491 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file ListenerGroup.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_LISTENERGROUP_H
+#define KRAKEN_LISTENERGROUP_H
+
+#include <Kraken/IO/Socket.h>
+#include <Kraken/IO/EPoll.h>
+#include <Kraken/IO/Event.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace Kraken
+{
+    /**
+     * The set of flags for `ListenerGroup::Open`.
+     */
+    enum class EListenerGroupFlags
+    {
+        None = 0,
+
+        /**
+         * Pin the thread of shard `i` to CPU `i` (modulo the amount of online CPUs).
+         */
+        PinThreads = 1 << 0,
+
+        /**
+         * Steer a connection received on CPU `k` to shard `k` (`SO_ATTACH_REUSEPORT_CBPF`),
+         * instead of the kernel's hash of the connection's addresses.
+         * Together with `PinThreads`, connections are accepted on the CPU that received them.
+         *
+         * @note Requires `N` to equal the amount of online CPUs.
+         */
+        CpuSteering = 1 << 1,
+
+        Default = PinThreads,
+    };
+
+    ENUM_FLAGS(EListenerGroupFlags);
+
+    /**
+     * A set of `N` listeners bound to the same address (`SO_REUSEPORT`), each accepting connections
+     * on its own thread through its own `EPoll`, so accepting isn't serialized on a single socket.
+     *
+     * @tparam D    The domain of the listeners. Must be an IP domain.
+     * @tparam N    The amount of listeners (shards).
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <ESocketDomain D, size_t N>
+    class ListenerGroup
+    {
+        static_assert((D == ESocketDomain::IPv4) || (D == ESocketDomain::IPv6), "SO_REUSEPORT requires an IP domain.");
+        static_assert(N > 0, "N must be positive.");
+
+    public:
+        /**
+         * Receives an accepted connection, on the thread of the shard that accepted it.
+         *
+         * @param context   The context given to `Start`.
+         * @param shard     The index of the shard that accepted the connection.
+         * @param client    The descriptor of the connection. Owned by the handler (e.g. wrap it with `Socket<D>`).
+         */
+        typedef void (*ConnectionHandler)(void *context, size_t shard, fd_t client);
+
+        ListenerGroup() :
+                m_flags(EListenerGroupFlags::None),
+                m_handler(nullptr),
+                m_context(nullptr),
+                m_runningShards(0)
+        {}
+
+        ~ListenerGroup()
+        {
+            Stop();
+        }
+
+        /**
+         * Opens, binds and starts listening on all of the shards.
+         *
+         * @param localAddress  The address to listen on.
+         * @param backlog       The size of each shard's waiting queue.
+         * @param flags         Flags of the group.
+         * @return `0` on success; `-EBUSY` if the group is already open;
+         *          `-EINVAL` if `EListenerGroupFlags::CpuSteering` is given and `N` isn't the amount of online CPUs;
+         *          `-errno` on error.
+         */
+        int Open(const Address<D> &localAddress, int backlog, EListenerGroupFlags flags = EListenerGroupFlags::Default)
+        {
+            int err;
+
+            if (m_stop.IsOpen())
+            {
+                return -EBUSY;
+            }
+
+            // With fewer shards than CPUs, `cpu % N` would send connections to shards pinned to other CPUs.
+            if (((flags & EListenerGroupFlags::CpuSteering) == EListenerGroupFlags::CpuSteering) &&
+                (sysconf(_SC_NPROCESSORS_ONLN) != (long)N))
+            {
+                KRAKEN_PRINT("CPU steering requires a shard per online CPU.");
+                return -EINVAL;
+            }
+
+            err = m_stop.Open(0, EEventFlags::CloseOnExec);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            m_flags = flags;
+
+            // The order of the listeners in the group is the order they were bound in.
+            for (size_t index = 0; index < N; index++)
+            {
+                err = OpenShard(m_shards[index], index, localAddress, backlog);
+                if (err != 0)
+                {
+                    Close();
+                    return err;
+                }
+            }
+
+            if ((flags & EListenerGroupFlags::CpuSteering) == EListenerGroupFlags::CpuSteering)
+            {
+                err = AttachCpuSteering();
+                if (err != 0)
+                {
+                    Close();
+                    return err;
+                }
+            }
+
+            return 0;
+        }
+
+        /**
+         * Starts the thread of every shard.
+         *
+         * @param handler   The function to receive accepted connections. Must be thread-safe.
+         * @param context   An opaque value passed to `handler`.
+         * @return `0` on success; `-errno` on error, in which case no thread is left running.
+         */
+        int Start(ConnectionHandler handler, void *context)
+        {
+            int err;
+
+            if ((handler == nullptr) || !m_stop.IsOpen())
+            {
+                return -EINVAL;
+            }
+
+            if (m_runningShards > 0)
+            {
+                return -EBUSY;
+            }
+
+            m_handler = handler;
+            m_context = context;
+
+            for (size_t index = 0; index < N; index++)
+            {
+                pthread_attr_t attributes;
+                pthread_attr_t *pinned = nullptr;
+
+                // Pin before the thread starts, so it never accepts on another CPU.
+                if (((m_flags & EListenerGroupFlags::PinThreads) == EListenerGroupFlags::PinThreads) &&
+                    (InitializePinning(attributes, index) == 0))
+                {
+                    pinned = &attributes;
+                }
+
+                err = pthread_create(&m_shards[index].thread, pinned, ShardEntry, &m_shards[index]);
+                if ((err == EINVAL) && (pinned != nullptr))
+                {
+                    // Pinning is an optimization; a shard that can't be pinned (e.g. outside its cpuset) still accepts.
+                    KRAKEN_PRINT("Failed to pin the thread of shard %zu.", index);
+                    err = pthread_create(&m_shards[index].thread, nullptr, ShardEntry, &m_shards[index]);
+                }
+
+                if (pinned != nullptr)
+                {
+                    pthread_attr_destroy(pinned);
+                }
+
+                if (err != 0)
+                {
+                    KRAKEN_PRINT("Failed to create the thread of shard %zu.", index);
+                    Stop();
+                    return -err;
+                }
+
+                m_runningShards++;
+            }
+
+            return 0;
+        }
+
+        /**
+         * Stops the threads of the shards, and waits for them to exit. The listeners stay open.
+         */
+        void Stop()
+        {
+            uint64_t wastefulImplementationDetail;
+
+            if (m_runningShards == 0)
+            {
+                return;
+            }
+
+            // The event stays signaled, so it wakes every shard.
+            m_stop.Post();
+
+            for (size_t index = 0; index < m_runningShards; index++)
+            {
+                pthread_join(m_shards[index].thread, nullptr);
+            }
+
+            m_runningShards = 0;
+            m_stop.Wait(wastefulImplementationDetail);
+        }
+
+        /**
+         * Stops the shards, and closes all of the listeners.
+         */
+        void Close()
+        {
+            Stop();
+
+            for (size_t index = 0; index < N; index++)
+            {
+                m_shards[index].poll.Close();
+                m_shards[index].listener.Close();
+            }
+
+            m_stop.Close();
+        }
+
+        /**
+         * @return The listener of the given shard.
+         */
+        inline Socket<D> &GetListener(size_t shard)
+        {
+            return m_shards[shard].listener;
+        }
+
+    private:
+        struct Shard
+        {
+            ListenerGroup *group;
+            size_t index;
+            Socket<D> listener;
+            EPoll<> poll;
+            pthread_t thread;
+        };
+
+        ListenerGroup(const ListenerGroup &) = delete;
+
+        int OpenShard(Shard &shard, size_t index, const Address<D> &localAddress, int backlog)
+        {
+            int err;
+
+            shard.group = this;
+            shard.index = index;
+
+            err = shard.listener.Open(ESocketType::Stream, ESocketFlags::CloseOnExec | ESocketFlags::NonBlock);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            err = shard.listener.template SetOption<SocketOption::ReusePort>(true);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            err = shard.listener.Bind(localAddress);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            err = shard.listener.Listen(backlog);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            err = shard.poll.Open();
+            if (err != 0)
+            {
+                return err;
+            }
+
+            err = shard.poll.AddWatch(shard.listener);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            return shard.poll.AddWatch(m_stop);
+        }
+
+        /**
+         * Picks the listener by `cpu % N` (i.e. `cpu`, as `N` is the amount of CPUs).
+         * Attaching to a single listener applies to the whole group.
+         */
+        int AttachCpuSteering()
+        {
+            struct sock_filter code[] = {
+                    BPF_STMT(BPF_LD | BPF_W | BPF_ABS, (uint32_t)(SKF_AD_OFF + SKF_AD_CPU)),
+                    BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, (uint32_t)N),
+                    BPF_STMT(BPF_RET | BPF_A, 0),
+            };
+            struct sock_fprog program;
+
+            program.len = sizeof(code) / sizeof(code[0]);
+            program.filter = code;
+
+            return m_shards[0].listener.template SetOption<SocketOption::AttachReusePortFilter>(program);
+        }
+
+        /**
+         * Initializes thread attributes that pin a thread to CPU `index` (modulo the amount of online CPUs).
+         */
+        static int InitializePinning(pthread_attr_t &o_attributes, size_t index)
+        {
+            long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+            cpu_set_t set;
+            int err;
+
+            CPU_ZERO(&set);
+            CPU_SET((cpus > 0) ? (index % (size_t)cpus) : 0, &set);
+
+            err = pthread_attr_init(&o_attributes);
+            if (err != 0)
+            {
+                return -err;
+            }
+
+            err = pthread_attr_setaffinity_np(&o_attributes, sizeof(set), &set);
+            if (err != 0)
+            {
+                pthread_attr_destroy(&o_attributes);
+                return -err;
+            }
+
+            return 0;
+        }
+
+        static void *ShardEntry(void *argument)
+        {
+            Shard *shard = (Shard *)argument;
+            shard->group->Run(*shard);
+            return nullptr;
+        }
+
+        void Run(Shard &shard)
+        {
+            IEPollable *ready[2];
+
+            while (true)
+            {
+                int count = shard.poll.Wait(ready);
+                if (count == -EINTR)
+                {
+                    continue;
+                }
+                else if (count < 0)
+                {
+                    KRAKEN_PRINT("Shard %zu failed to wait. err = %d", shard.index, count);
+                    return;
+                }
+
+                for (int index = 0; index < count; index++)
+                {
+                    if (ready[index] == &m_stop)
+                    {
+                        return;
+                    }
+                }
+
+                // The listener stays readable while the backlog can't be accepted; back off instead of spinning.
+                if (!AcceptAll(shard) && IsStopped(s_BackoffMilliseconds))
+                {
+                    return;
+                }
+            }
+        }
+
+        /**
+         * Accepts connections until the backlog is drained.
+         *
+         * @return `false` if accepting failed for a lack of resources (e.g. `EMFILE`), and should be retried later.
+         */
+        bool AcceptAll(Shard &shard)
+        {
+            while (true)
+            {
+                Socket<D> client;
+
+                int err = shard.listener.Accept(client, EAcceptFlags::CloseOnExec);
+                if (err == 0)
+                {
+                    m_handler(m_context, shard.index, client.Detach());
+                    continue;
+                }
+
+                // A connection that was reset while queued doesn't affect the rest of the backlog.
+                if (err == -ECONNABORTED)
+                {
+                    continue;
+                }
+
+                if ((err == -EMFILE) || (err == -ENFILE) || (err == -ENOBUFS) || (err == -ENOMEM))
+                {
+                    KRAKEN_PRINT("Shard %zu ran out of resources to accept. err = %d", shard.index, err);
+                    return false;
+                }
+
+                // `EAGAIN` means the backlog is drained; on other errors, retry on the next wakeup.
+                if (err != -EAGAIN)
+                {
+                    KRAKEN_PRINT("Shard %zu failed to accept. err = %d", shard.index, err);
+                }
+
+                return true;
+            }
+        }
+
+        /**
+         * Waits for the group to be stopped.
+         *
+         * @param timeout   The wait timeout in milliseconds.
+         * @return `true` if the group was stopped.
+         */
+        bool IsStopped(int timeout)
+        {
+            struct pollfd stop;
+
+            stop.fd = m_stop.GetFileDescriptor();
+            stop.events = POLLIN;
+            stop.revents = 0;
+
+            return poll(&stop, 1, timeout) > 0;
+        }
+
+        /**
+         * The time a shard waits before accepting again, after running out of resources.
+         */
+        static constexpr int s_BackoffMilliseconds = 100;
+
+        Shard m_shards[N];
+        Event m_stop;
+        EListenerGroupFlags m_flags;
+        ConnectionHandler m_handler;
+        void *m_context;
+        size_t m_runningShards;
+    };
+}
+
+#endif //KRAKEN_LISTENERGROUP_H
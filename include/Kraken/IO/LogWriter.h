@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file LogWriter.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_LOGWRITER_H
+#define KRAKEN_LOGWRITER_H
+
+#include <Kraken/IO/File.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
+
+namespace Kraken
+{
+    /**
+     * The on-disk header preceding every log record.
+     */
+    struct LogRecordHeader
+    {
+        /**
+         * The length of the record's payload, in bytes.
+         */
+        uint32_t length;
+
+        /**
+         * CRC-32C of `length` followed by the payload.
+         */
+        uint32_t checksum;
+    };
+
+    /**
+     * Per-record flags for `LogWriter::Append`.
+     */
+    enum class ELogAppendFlags
+    {
+        None = 0,
+
+        /**
+         * Do not return before the record is durable, regardless of the sync thresholds.
+         */
+        Sync = 1 << 0,
+    };
+
+    ENUM_FLAGS(ELogAppendFlags);
+
+    /**
+     * An append-only log of length-prefixed, checksummed records, stored as a sequence of segment files
+     * (`<directory>/<index>.log`, numbered sequentially).
+     *
+     * Concurrent appends are batched: the first thread to find the log idle becomes the leader and writes
+     * every queued record in a single `writev`, while the other threads wait for it to finish.
+     * `fdatasync` is amortized across batches (group commit), and issued once the unsynced data crosses
+     * a byte threshold or a time window. The time window is enforced by a background thread,
+     * so records don't stay unsynced when the log goes idle.
+     *
+     * Opening an existing log resumes the last segment, discarding any torn or corrupted records at its tail.
+     *
+     * @note `Open` and `Close` must not race with other calls; `Append` and `Sync` are thread-safe.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class LogWriter
+    {
+    public:
+        LogWriter();
+
+        ~LogWriter();
+
+        /**
+         * Opens the log in the given directory, creating its first segment if there is none.
+         *
+         * When both sync thresholds are `0`, every batch is synced before it is acknowledged.
+         *
+         * @param directory             The directory holding the segment files. Must exist.
+         * @param segmentSize           The size, in bytes, after which a new segment is started.
+         *                              A record that is larger than a segment gets a segment of its own.
+         * @param syncBytes             Sync once this many bytes are unsynced. `0` disables the threshold.
+         * @param syncIntervalMicros    Sync once the oldest unsynced record is this old. `0` disables the window;
+         *                              otherwise a background thread syncs the log when the window passes.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(const char *directory, size_t segmentSize, size_t syncBytes = 0, uint64_t syncIntervalMicros = 0);
+
+        /**
+         * Appends a record to the log.
+         * Returns once the record was written by this thread or by a concurrent leader.
+         *
+         * @param record    The record's payload.
+         * @param length    The length of the payload, in bytes.
+         * @param flags     Per-record flags.
+         *
+         * @return `0` on success; `-errno` on error.
+         *          After a write error, the log refuses further appends with the same error.
+         */
+        int Append(const void *record, size_t length, ELogAppendFlags flags = ELogAppendFlags::None);
+
+        /**
+         * Appends a record to the log.
+         *
+         * @param record    The record's payload.
+         * @param flags     Per-record flags.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        inline int Append(const_membuf record, ELogAppendFlags flags = ELogAppendFlags::None)
+        {
+            return Append(record.buffer, record.length, flags);
+        }
+
+        /**
+         * Makes every appended record durable.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Sync();
+
+        /**
+         * @return The index of the segment currently appended to.
+         */
+        uint64_t GetSegmentIndex();
+
+        /**
+         * @return The amount of appended bytes that are not durable yet.
+         */
+        size_t GetUnsyncedLength();
+
+        /**
+         * @return `true` if the log is open.
+         */
+        inline bool IsOpen()
+        {
+            return m_isOpen;
+        }
+
+        /**
+         * Stops the background sync, then syncs and closes the current segment.
+         */
+        void Close();
+
+    private:
+        struct PendingRecord;
+
+        /**
+         * The maximal amount of records written in a single `writev`.
+         */
+        static constexpr size_t s_MaxBatchRecords = IOV_MAX / 2;
+
+        int OpenSegment(uint64_t index, bool create);
+        int RollSegment();
+        int WriteBatch(PendingRecord *first, size_t count, size_t bytes, bool roll, bool sync);
+        int SyncSegment();
+        bool ShouldSync(bool forced);
+        void RunSyncLoop();
+
+        static void *SyncThreadEntry(void *context);
+
+        LogWriter(const LogWriter &) = delete;
+
+        pthread_mutex_t m_lock;
+        pthread_cond_t m_idle;
+        PendingRecord *m_head;
+        PendingRecord *m_tail;
+        bool m_leaderActive;
+        int m_error;
+
+        /**
+         * Set by `Open` and `Close`; the segment itself is briefly closed by a leader that rolls it.
+         */
+        bool m_isOpen;
+
+        File m_segment;
+        uint64_t m_segmentIndex;
+        size_t m_segmentLength;
+        size_t m_segmentSize;
+
+        size_t m_syncBytes;
+        uint64_t m_syncInterval;
+        size_t m_unsyncedBytes;
+        uint64_t m_unsyncedSince;
+
+        pthread_t m_syncThread;
+        bool m_isSyncThreadRunning;
+        bool m_stopSyncThread;
+
+        char m_directory[PATH_MAX];
+    };
+
+    /**
+     * Reads back the records of a log written by `LogWriter`, in order.
+     *
+     * A torn or corrupted record at the end of the last segment is treated as the end of the log
+     * (that's what a crash in the middle of a write leaves behind); anywhere else it is an error.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class LogScanner
+    {
+    public:
+        LogScanner() :
+                m_segmentIndex(0),
+                m_lastSegmentIndex(0),
+                m_offset(0),
+                m_isTornTail(false)
+        {}
+
+        /**
+         * Opens the log in the given directory, positioned at its first record.
+         *
+         * @param directory The directory holding the segment files.
+         *
+         * @return `0` on success; `-ENOENT` if the directory contains no segments; `-errno` on error.
+         */
+        int Open(const char *directory);
+
+        /**
+         * Reads the next record.
+         *
+         * @param o_buffer  The buffer to fill with the record's payload.
+         *
+         * @return The length of the record on success; `0` at the end of the log;
+         *          `-EMSGSIZE` if the record is larger than the buffer (the record is not consumed);
+         *          `-EBADMSG` if a record in the middle of the log is corrupted; `-errno` on error.
+         */
+        ssize_t Next(membuf o_buffer);
+
+        /**
+         * @return The index of the segment holding the next record.
+         */
+        inline uint64_t GetSegmentIndex() const
+        {
+            return m_segmentIndex;
+        }
+
+        /**
+         * @return The offset of the next record inside its segment.
+         */
+        inline off_t GetOffset() const
+        {
+            return m_offset;
+        }
+
+        /**
+         * @return `true` if the scan ended at a torn or corrupted record.
+         */
+        inline bool IsTornTail() const
+        {
+            return m_isTornTail;
+        }
+
+    private:
+        int OpenSegment(uint64_t index);
+
+        LogScanner(const LogScanner &) = delete;
+
+        File m_segment;
+        uint64_t m_segmentIndex;
+        uint64_t m_lastSegmentIndex;
+        off_t m_offset;
+        bool m_isTornTail;
+        char m_directory[PATH_MAX];
+    };
+}
+
+#endif //KRAKEN_LOGWRITER_H
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file MemFile.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_MEMFILE_H
+#define KRAKEN_MEMFILE_H
+
+#include <Kraken/IO/File.h>
+#include <Kraken/IO/MemoryMapping.h>
+#include <linux/memfd.h>
+
+namespace Kraken
+{
+    /**
+     * The set of memory-file creation flags.
+     */
+    enum class EMemFileFlags
+    {
+        None = 0,
+        CloseOnExec = MFD_CLOEXEC,
+
+        /**
+         * Allow seals to be added to the file. Without it, the file is created with `ESeals::Seal`.
+         */
+        AllowSealing = MFD_ALLOW_SEALING,
+
+        /**
+         * Back the file with huge pages of the default size.
+         * The size of the file must be a multiple of the huge page size.
+         */
+        HugeTLB = MFD_HUGETLB,
+        HugeTLB2MB = MFD_HUGETLB | MFD_HUGE_2MB,
+        HugeTLB1GB = MFD_HUGETLB | MFD_HUGE_1GB,
+    };
+
+    /**
+     * Seals restrict the operations allowed on a memory file, for as long as it exists.
+     */
+    enum class ESeals
+    {
+        None = 0,
+
+        /**
+         * Prevent further seals from being added.
+         */
+        Seal = F_SEAL_SEAL,
+
+        /**
+         * Prevent the file from shrinking.
+         */
+        Shrink = F_SEAL_SHRINK,
+
+        /**
+         * Prevent the file from growing.
+         */
+        Grow = F_SEAL_GROW,
+
+        /**
+         * Prevent any modification of the contents. Fails while writable shared mappings exist.
+         */
+        Write = F_SEAL_WRITE,
+
+        /**
+         * Prevent modification of the contents through new writes and mappings,
+         * while existing writable mappings keep working.
+         */
+        FutureWrite = F_SEAL_FUTURE_WRITE,
+    };
+
+    ENUM_FLAGS(EMemFileFlags);
+    ENUM_FLAGS(ESeals);
+
+    /**
+     * An anonymous, memory-backed file (`memfd_create`).
+     *
+     * A sealed memory file can be handed to another process (e.g. over a Unix socket), which can then
+     * map it without copying, and trust that its size and contents won't change under it.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class MemFile : public File
+    {
+    public:
+        MemFile() {}
+
+        MemFile(fd_t descriptor) : File(descriptor) {}
+
+        /**
+         * Creates the memory file, and sizes it.
+         *
+         * @param name  A name for the file, for debugging purposes. Need not be unique.
+         * @param size  The initial size of the file, in bytes.
+         * @param flags Creation flags.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(const char *name, size_t size,
+                 EMemFileFlags flags = EMemFileFlags::CloseOnExec | EMemFileFlags::AllowSealing);
+
+        /**
+         * Adds seals to the file. Seals can't be removed.
+         *
+         * @param seals The seals to add.
+         *
+         * @return `0` on success; `-EPERM` if the file is sealed against sealing; `-errno` on error.
+         */
+        int AddSeals(ESeals seals);
+
+        /**
+         * Queries the seals of the file.
+         *
+         * @param o_seals   After a successful call, will contain the seals of the file.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int GetSeals(ESeals &o_seals);
+
+        /**
+         * Queries the size of the file.
+         *
+         * @param o_size    After a successful call, will contain the size of the file, in bytes.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int GetSize(size_t &o_size);
+
+        /**
+         * Maps the entire file as shared memory.
+         *
+         * @param o_mapping     The mapping to fill. Must not hold a mapping.
+         * @param protection    The access permissions of the mapping.
+         *                      Must not contain `EProtection::Write` once the file is sealed for writing.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Map(MemoryMapping &o_mapping, EProtection protection = EProtection::ReadWrite);
+
+    private:
+        MemFile(const MemFile &) = delete;
+    };
+}
+
+#endif //KRAKEN_MEMFILE_H
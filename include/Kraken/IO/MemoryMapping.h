@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file MemoryMapping.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_MEMORYMAPPING_H
+#define KRAKEN_MEMORYMAPPING_H
+
+#include <Kraken/IO/File.h>
+#include <Kraken/membuf.h>
+#include <sys/mman.h>
+
+namespace Kraken
+{
+    /**
+     * The access permissions of a mapping.
+     */
+    enum class EProtection
+    {
+        None = PROT_NONE,
+        Read = PROT_READ,
+        Write = PROT_WRITE,
+        Execute = PROT_EXEC,
+        ReadWrite = PROT_READ | PROT_WRITE,
+    };
+
+    /**
+     * The set of mapping flags.
+     */
+    enum class EMappingFlags
+    {
+        /**
+         * Changes are visible to other mappings of the same file, and are carried through to the file.
+         */
+        Shared = MAP_SHARED,
+
+        /**
+         * Changes are copy-on-write, and are private to the mapping.
+         */
+        Private = MAP_PRIVATE,
+
+        /**
+         * Prefault the page tables of the mapping.
+         */
+        Populate = MAP_POPULATE,
+
+        /**
+         * Lock the pages of the mapping in memory.
+         */
+        Locked = MAP_LOCKED,
+
+        /**
+         * Back the mapping with huge pages.
+         */
+        HugeTLB = MAP_HUGETLB,
+
+        /**
+         * With `HugeTLB`, use 2MB huge pages rather than the system's default huge page size.
+         */
+        HugePageSize2MB = 21 << MAP_HUGE_SHIFT,
+
+        /**
+         * Do not reserve swap space for the mapping.
+         */
+        NoReserve = MAP_NORESERVE,
+    };
+
+    /**
+     * Usage hints for a mapping (`madvise`).
+     */
+    enum class EMemoryAdvice
+    {
+        Normal = MADV_NORMAL,
+        Random = MADV_RANDOM,
+        Sequential = MADV_SEQUENTIAL,
+        WillNeed = MADV_WILLNEED,
+        DontNeed = MADV_DONTNEED,
+
+        /**
+         * Back the mapping with transparent huge pages.
+         */
+        HugePage = MADV_HUGEPAGE,
+        NoHugePage = MADV_NOHUGEPAGE,
+
+        /**
+         * Prefault the page tables of the mapping, as if it was read (since Linux 5.14).
+         */
+        PopulateRead = MADV_POPULATE_READ,
+
+        /**
+         * Prefault the page tables of the mapping, as if it was written (since Linux 5.14).
+         */
+        PopulateWrite = MADV_POPULATE_WRITE,
+    };
+
+    ENUM_FLAGS(EProtection);
+    ENUM_FLAGS(EMappingFlags);
+
+    /**
+     * An owned memory mapping (`mmap`), unmapped when the object is destroyed.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class MemoryMapping
+    {
+    public:
+        MemoryMapping() :
+                m_address(nullptr),
+                m_length(0)
+        {}
+
+        ~MemoryMapping()
+        {
+            Unmap();
+        }
+
+        /**
+         * Maps a region of a file.
+         *
+         * @param file          The file to map.
+         * @param length        The length of the region, in bytes.
+         * @param protection    The access permissions of the mapping.
+         * @param flags         Mapping flags. Must contain either `Shared` or `Private`.
+         * @param offset        The offset of the region inside the file. Must be page-aligned.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Map(const File &file, size_t length, EProtection protection = EProtection::ReadWrite,
+                EMappingFlags flags = EMappingFlags::Shared, off_t offset = 0);
+
+        /**
+         * Maps zero-filled memory that isn't backed by any file.
+         *
+         * @param length        The length of the mapping, in bytes.
+         * @param protection    The access permissions of the mapping.
+         * @param flags         Mapping flags. Must contain either `Shared` or `Private`.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int MapAnonymous(size_t length, EProtection protection = EProtection::ReadWrite,
+                         EMappingFlags flags = EMappingFlags::Private);
+
+        /**
+         * Gives the kernel a hint about the usage of the whole mapping.
+         *
+         * @param advice    The usage hint.
+         * @return `0` on success; `-errno` on error.
+         */
+        int Advise(EMemoryAdvice advice);
+
+        /**
+         * Locks the pages of the mapping in memory, faulting them in (`mlock`).
+         * The pages are unlocked when the mapping is unmapped.
+         *
+         * @return `0` on success; `-errno` on error (e.g. `-ENOMEM` if `RLIMIT_MEMLOCK` is exceeded).
+         */
+        int Lock();
+
+        /**
+         * Shrinks the mapping to a sub-range of itself, unmapping the memory around it.
+         *
+         * @param offset    The start of the range to keep, relative to the mapping. Must be page-aligned.
+         * @param length    The length of the range to keep, in bytes. Must be page-aligned.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Trim(size_t offset, size_t length);
+
+        /**
+         * Unmaps the memory, if it is mapped.
+         */
+        void Unmap();
+
+        /**
+         * @return `true` if the object holds a mapping.
+         */
+        inline bool IsMapped() const
+        {
+            return m_address != nullptr;
+        }
+
+        /**
+         * @return The start of the mapping.
+         */
+        inline void *GetAddress() const
+        {
+            return m_address;
+        }
+
+        /**
+         * @return The length of the mapping, in bytes.
+         */
+        inline size_t GetLength() const
+        {
+            return m_length;
+        }
+
+        /**
+         * Casts the mapping into a `membuf`.
+         */
+        inline operator membuf()
+        {
+            return membuf(m_address, m_length);
+        }
+
+        /**
+         * Casts the mapping into a `const_membuf`.
+         */
+        inline operator const_membuf() const
+        {
+            return const_membuf(m_address, m_length);
+        }
+
+    private:
+        int Map(fd_t descriptor, size_t length, EProtection protection, EMappingFlags flags, off_t offset);
+
+        MemoryMapping(const MemoryMapping &) = delete;
+
+        void *m_address;
+        size_t m_length;
+    };
+}
+
+#endif //KRAKEN_MEMORYMAPPING_H
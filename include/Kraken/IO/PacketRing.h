@@ -0,0 +1,419 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file PacketRing.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_PACKETRING_H
+#define KRAKEN_PACKETRING_H
+
+#include <Kraken/IO/Socket.h>
+#include <Kraken/IO/MemoryMapping.h>
+#include <stdint.h>
+#include <time.h>
+
+namespace Kraken
+{
+    /**
+     * A frame captured into a `PacketReceiveRing`, read in place.
+     */
+    class PacketFrame
+    {
+    public:
+        PacketFrame(const tpacket3_hdr *header) :
+                m_header(header)
+        {}
+
+        /**
+         * @return The captured bytes of the frame, starting at the link-layer header.
+         */
+        inline const_membuf GetData() const
+        {
+            return const_membuf((const uint8_t *)m_header + m_header->tp_mac, m_header->tp_snaplen);
+        }
+
+        /**
+         * @return The length of the frame on the wire.
+         */
+        inline uint32_t GetLength() const
+        {
+            return m_header->tp_len;
+        }
+
+        /**
+         * @return `true` if only part of the frame was captured.
+         */
+        inline bool IsTruncated() const
+        {
+            return m_header->tp_snaplen < m_header->tp_len;
+        }
+
+        /**
+         * @return The time (`CLOCK_REALTIME`) the frame was captured at.
+         */
+        inline struct timespec GetTimestamp() const
+        {
+            struct timespec timestamp;
+
+            timestamp.tv_sec = m_header->tp_sec;
+            timestamp.tv_nsec = m_header->tp_nsec;
+            return timestamp;
+        }
+
+        /**
+         * @return The index of the interface the frame was captured on.
+         */
+        inline int GetInterfaceIndex() const
+        {
+            return GetLinkAddress()->sll_ifindex;
+        }
+
+        /**
+         * @return The ethertype of the frame, in host byte order.
+         */
+        inline uint16_t GetProtocol() const
+        {
+            return ntohs(GetLinkAddress()->sll_protocol);
+        }
+
+        /**
+         * @return The classification of the frame.
+         */
+        inline EPacketType GetPacketType() const
+        {
+            return (EPacketType)GetLinkAddress()->sll_pkttype;
+        }
+
+    private:
+        inline const sockaddr_ll *GetLinkAddress() const
+        {
+            return (const sockaddr_ll *)((const uint8_t *)m_header + TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+        }
+
+        const tpacket3_hdr *m_header;
+    };
+
+    /**
+     * A block of frames, handed over by a `PacketReceiveRing` and owned by the caller until released.
+     *
+     * Iterating a block visits its frames in order:
+     *
+     *      for (PacketFrame frame : block) { ... }
+     */
+    class PacketBlock
+    {
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(const uint8_t *position, uint32_t remaining) :
+                    m_position(position),
+                    m_remaining(remaining)
+            {}
+
+            inline PacketFrame operator *() const
+            {
+                return PacketFrame((const tpacket3_hdr *)m_position);
+            }
+
+            inline Iterator &operator ++()
+            {
+                m_position += ((const tpacket3_hdr *)m_position)->tp_next_offset;
+                m_remaining--;
+                return *this;
+            }
+
+            inline bool operator !=(const Iterator &other) const
+            {
+                return m_remaining != other.m_remaining;
+            }
+
+        private:
+            const uint8_t *m_position;
+            uint32_t m_remaining;
+        };
+
+        PacketBlock() :
+                m_block(nullptr)
+        {}
+
+        /**
+         * @return The amount of frames in the block.
+         */
+        inline uint32_t GetFrameCount() const
+        {
+            return (m_block != nullptr) ? m_block->hdr.bh1.num_pkts : 0;
+        }
+
+        /**
+         * @return The sequence number of the block. Consecutive blocks have consecutive numbers.
+         */
+        inline uint64_t GetSequence() const
+        {
+            return (m_block != nullptr) ? m_block->hdr.bh1.seq_num : 0;
+        }
+
+        inline Iterator begin() const
+        {
+            if (m_block == nullptr)
+            {
+                return end();
+            }
+
+            return Iterator((const uint8_t *)m_block + m_block->hdr.bh1.offset_to_first_pkt, GetFrameCount());
+        }
+
+        inline Iterator end() const
+        {
+            return Iterator(nullptr, 0);
+        }
+
+    private:
+        friend class PacketReceiveRing;
+
+        tpacket_block_desc *m_block;
+    };
+
+    /**
+     * A memory-mapped receive ring (`PACKET_RX_RING`, `TPACKET_V3`) of a packet socket.
+     *
+     * The kernel fills whole blocks of frames and hands each one over when it's full, or when `blockTimeout`
+     * passes since its first frame; so a capturing thread pays neither a system call nor a copy per frame.
+     *
+     * @note The ring must be set up before frames flow - open the socket with protocol `0`,
+     *          open the ring, and only then bind the socket (and join a fanout group).
+     * @note Each ring is mapped on its own, so a socket can carry only one of them; use separate sockets
+     *          for receiving and transmitting. (Linux itself can share a socket between an RX and a TX ring,
+     *          when both are set up before a single `mmap`; this API doesn't.)
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class PacketReceiveRing
+    {
+    public:
+        PacketReceiveRing() :
+                m_socket(nullptr),
+                m_blockSize(0),
+                m_blockCount(0),
+                m_index(0)
+        {}
+
+        ~PacketReceiveRing()
+        {
+            Close();
+        }
+
+        /**
+         * Sets up the ring on the given socket, and maps it.
+         *
+         * @param socket        An open packet socket. Must outlive the ring.
+         * @param blockSize     The size of each block. Must be a multiple of the page size, and fit the largest frame.
+         * @param blockCount    The amount of blocks in the ring.
+         * @param blockTimeout  The time, in milliseconds, after which a partially-filled block is handed over.
+         *
+         * @return `0` on success; `-EBUSY` if the ring is open, or the socket already has a ring; `-errno` on error.
+         */
+        int Open(PacketSocket &socket, uint32_t blockSize, uint32_t blockCount, uint32_t blockTimeout = 10);
+
+        /**
+         * Gets the next block of frames, in ring order.
+         * The block stays owned by the caller - and this keeps returning it - until it is released.
+         *
+         * @param o_block   Filled with the block.
+         * @param timeout   The wait timeout in milliseconds. `-1` to wait indefinitly, `0` for non-block operation.
+         *
+         * @return `0` on success; `-EAGAIN` if no block was handed over in time;
+         *          the pending socket error (`SO_ERROR`) as `-errno`;
+         *          `-ENOMSG` if the socket's error queue holds messages (e.g. transmit timestamps) to be read first,
+         *          with `Socket::ReadErrorQueue` (or `Socket::ReadTransmitTimestamps`);
+         *          `-errno` on error.
+         */
+        int Next(PacketBlock &o_block, int timeout = -1);
+
+        /**
+         * Hands the block back to the kernel.
+         *
+         * @note The frames of the block must not be accessed afterwards.
+         *
+         * @param block The block returned by the last call to `Next`.
+         */
+        void Release(PacketBlock &block);
+
+        /**
+         * Unmaps the ring, and removes it from the socket if the socket is still open.
+         */
+        void Close();
+
+        /**
+         * @return `true` if the ring is set up.
+         */
+        inline bool IsOpen() const
+        {
+            return m_socket != nullptr;
+        }
+
+        inline uint32_t GetBlockSize() const
+        {
+            return m_blockSize;
+        }
+
+        inline uint32_t GetBlockCount() const
+        {
+            return m_blockCount;
+        }
+
+    private:
+        PacketReceiveRing(const PacketReceiveRing &) = delete;
+
+        inline tpacket_block_desc *GetBlock(uint32_t index) const
+        {
+            return (tpacket_block_desc *)((uint8_t *)m_mapping.GetAddress() + (size_t)index * m_blockSize);
+        }
+
+        PacketSocket *m_socket;
+        MemoryMapping m_mapping;
+        uint32_t m_blockSize;
+        uint32_t m_blockCount;
+        uint32_t m_index;
+    };
+
+    /**
+     * A memory-mapped transmit ring (`PACKET_TX_RING`, `TPACKET_V3`) of a packet socket.
+     *
+     * Frames are written in place and queued with `Commit`; a single `Flush` then transmits all of them.
+     *
+     * @note The socket must be bound to the interface (and ethertype) to transmit on.
+     * @note Each ring is mapped on its own, so a socket can carry only one of them; use separate sockets
+     *          for receiving and transmitting. (Linux itself can share a socket between an RX and a TX ring,
+     *          when both are set up before a single `mmap`; this API doesn't.)
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class PacketTransmitRing
+    {
+    public:
+        PacketTransmitRing() :
+                m_socket(nullptr),
+                m_frameSize(0),
+                m_frameCount(0),
+                m_index(0)
+        {}
+
+        ~PacketTransmitRing()
+        {
+            Close();
+        }
+
+        /**
+         * Sets up the ring on the given socket, and maps it.
+         *
+         * @param socket        An open packet socket. Must outlive the ring.
+         * @param blockSize     The size of each block. Must be a multiple of the page size.
+         * @param blockCount    The amount of blocks in the ring.
+         * @param frameSize     The size of each frame slot, including its header. Must divide `blockSize`.
+         *
+         * @return `0` on success; `-EBUSY` if the ring is open, or the socket already has a ring; `-errno` on error.
+         */
+        int Open(PacketSocket &socket, uint32_t blockSize, uint32_t blockCount, uint32_t frameSize = 2048);
+
+        /**
+         * Returns the next free frame slot, to write a frame (starting at its link-layer header) into.
+         * Acquiring again before committing returns the same slot.
+         *
+         * @return The slot on success; an empty `membuf` if the ring is full (or not open).
+         */
+        membuf Acquire();
+
+        /**
+         * Queues the acquired frame for transmission.
+         *
+         * @param length    The length of the frame written into the slot.
+         * @return `0` on success; `-ENOBUFS` if no slot was acquired; `-EMSGSIZE` if the frame doesn't fit the slot.
+         */
+        int Commit(size_t length);
+
+        /**
+         * Transmits the queued frames.
+         *
+         * @param wait  `true` to block until all of the queued frames were handed to the device.
+         * @return On success, the amount of bytes transmitted; on error `-errno`.
+         */
+        ssize_t Flush(bool wait = false);
+
+        /**
+         * Unmaps the ring, and removes it from the socket if the socket is still open.
+         */
+        void Close();
+
+        /**
+         * @return `true` if the ring is set up.
+         */
+        inline bool IsOpen() const
+        {
+            return m_socket != nullptr;
+        }
+
+        /**
+         * @return The maximal length of a frame.
+         */
+        inline size_t GetMaxFrameLength() const
+        {
+            return m_frameSize - s_DataOffset;
+        }
+
+        inline uint32_t GetFrameCount() const
+        {
+            return m_frameCount;
+        }
+
+    private:
+        /**
+         * The offset of a frame's data inside its slot.
+         */
+        static constexpr size_t s_DataOffset = TPACKET_ALIGN(sizeof(tpacket3_hdr));
+
+        PacketTransmitRing(const PacketTransmitRing &) = delete;
+
+        inline tpacket3_hdr *GetFrame(uint32_t index) const
+        {
+            return (tpacket3_hdr *)((uint8_t *)m_mapping.GetAddress() + (size_t)index * m_frameSize);
+        }
+
+        /**
+         * @return `true` if the current slot can be written.
+         */
+        bool IsAvailable() const;
+
+        PacketSocket *m_socket;
+        MemoryMapping m_mapping;
+        uint32_t m_frameSize;
+        uint32_t m_frameCount;
+        uint32_t m_index;
+    };
+}
+
+#endif //KRAKEN_PACKETRING_H
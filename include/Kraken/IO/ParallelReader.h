@@ -0,0 +1,382 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file ParallelReader.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_PARALLELREADER_H
+#define KRAKEN_PARALLELREADER_H
+
+#include <Kraken/IO/File.h>
+#include <Kraken/Stack.h>
+#include <pthread.h>
+
+namespace Kraken
+{
+    /**
+     * The order in which `ParallelReader` delivers chunks.
+     */
+    enum class EChunkOrder
+    {
+        /**
+         * Chunks are delivered by offset, one at a time.
+         */
+        InOrder,
+
+        /**
+         * Chunks are delivered as soon as they are read, possibly concurrently from several threads.
+         */
+        AnyOrder,
+    };
+
+    /**
+     * Reads a region of a file in fixed-size chunks from several threads at once (`File::ReadAt`),
+     * to keep more requests in flight than a single blocking reader can (e.g. on NVMe devices).
+     *
+     * Memory is bounded by the caller's storage, which is split into up to `Slots` chunk buffers;
+     * a thread only starts reading a chunk once a buffer is free.
+     *
+     * @note For direct IO, the storage (see `aligned_buffer`), the chunk size and the region's start
+     *          must be aligned to the logical block size.
+     *
+     * @tparam Threads  The amount of reading threads, including the calling thread.
+     * @tparam Slots    The maximal amount of chunk buffers.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <size_t Threads, size_t Slots = 2 * Threads>
+    class ParallelReader
+    {
+        static_assert(Threads > 0, "Threads must be positive.");
+        static_assert(Slots > 0, "Slots must be positive.");
+
+    public:
+        /**
+         * Receives a chunk.
+         *
+         * @param context   The context given to `Read`.
+         * @param offset    The file offset of the chunk.
+         * @param data      The contents of the chunk. Only valid during the call.
+         *
+         * @return `0` to continue; any other value stops the read, and is returned by `Read`.
+         */
+        typedef int (*ChunkHandler)(void *context, off_t offset, const_membuf data);
+
+        /**
+         * Constructs a reader.
+         *
+         * @param file      The file to read. Must outlive the reader.
+         * @param storage   The memory to read chunks into. Must outlive the reader.
+         * @param chunkSize The size of each chunk, in bytes.
+         */
+        ParallelReader(File &file, membuf storage, size_t chunkSize) :
+                m_file(file),
+                m_storage((unsigned char *)storage.buffer),
+                m_chunkSize(chunkSize),
+                m_slotCount((chunkSize > 0) ? (storage.length / chunkSize) : 0)
+        {
+            if (m_slotCount > Slots)
+            {
+                m_slotCount = Slots;
+            }
+
+            pthread_mutex_init(&m_lock, nullptr);
+            pthread_cond_init(&m_changed, nullptr);
+        }
+
+        ~ParallelReader()
+        {
+            pthread_cond_destroy(&m_changed);
+            pthread_mutex_destroy(&m_lock);
+        }
+
+        /**
+         * Reads a region of the file, and hands its chunks to `handler`.
+         * Blocks until the whole region was delivered, or until an error.
+         *
+         * @param start     The offset of the region.
+         * @param length    The length of the region, in bytes. `0` reads until the end of the file.
+         * @param handler   The function to receive the chunks.
+         * @param context   An opaque value passed to `handler`.
+         * @param order     The order of delivery. With `EChunkOrder::AnyOrder`, `handler` must be thread-safe.
+         *
+         * @return `0` on success; `-EINVAL` if the storage can't hold a single chunk;
+         *          the value returned by `handler` if it stopped the read; `-errno` on error.
+         */
+        int Read(off_t start, off_t length, ChunkHandler handler, void *context,
+                 EChunkOrder order = EChunkOrder::InOrder)
+        {
+            // Zero-length arrays aren't standard; the single-thread reader has a spare slot.
+            pthread_t threads[(Threads > 1) ? Threads - 1 : 1];
+            size_t threadCount = 0;
+            struct stat info;
+
+            if ((handler == nullptr) || (m_storage == nullptr) || (m_slotCount == 0) || (start < 0) || (length < 0))
+            {
+                KRAKEN_PRINT("Invalid parameters.");
+                return -EINVAL;
+            }
+
+            if (length == 0)
+            {
+                if (fstat(m_file.GetFileDescriptor(), &info) != 0)
+                {
+                    return -errno;
+                }
+
+                length = (info.st_size > start) ? (info.st_size - start) : 0;
+            }
+
+            m_start = start;
+            m_end = start + length;
+            m_chunkCount = ((size_t)length + m_chunkSize - 1) / m_chunkSize;
+            m_nextChunk = 0;
+            m_nextDelivery = 0;
+            m_isDelivering = false;
+            m_error = 0;
+            m_handler = handler;
+            m_context = context;
+            m_order = order;
+
+            for (size_t slot = 0; slot < m_slotCount; slot++)
+            {
+                m_slots[slot].isReady = false;
+                m_free.Push(slot);
+            }
+
+            // Failing to start a thread only means less parallelism; the calling thread reads as well.
+            for (; threadCount < Threads - 1; threadCount++)
+            {
+                if (pthread_create(&threads[threadCount], nullptr, WorkerEntry, this) != 0)
+                {
+                    KRAKEN_PRINT("Failed to create a reader thread.");
+                    break;
+                }
+            }
+
+            Work();
+
+            for (size_t index = 0; index < threadCount; index++)
+            {
+                pthread_join(threads[index], nullptr);
+            }
+
+            size_t slot;
+            while (m_free.Pop(slot)) {}
+
+            return m_error;
+        }
+
+    private:
+        struct Slot
+        {
+            size_t chunk;
+            size_t length;
+            bool isReady;
+        };
+
+        ParallelReader(const ParallelReader &) = delete;
+
+        static void *WorkerEntry(void *self)
+        {
+            ((ParallelReader *)self)->Work();
+            return nullptr;
+        }
+
+        inline unsigned char *GetSlotBuffer(size_t slot) const
+        {
+            return m_storage + slot * m_chunkSize;
+        }
+
+        inline off_t GetChunkOffset(size_t chunk) const
+        {
+            return m_start + (off_t)(chunk * m_chunkSize);
+        }
+
+        inline void SetError(int err)
+        {
+            if (m_error == 0)
+            {
+                m_error = err;
+            }
+        }
+
+        /**
+         * Reads a chunk into a slot, retrying short reads.
+         */
+        ssize_t ReadChunk(size_t slot, size_t chunk)
+        {
+            unsigned char *buffer = GetSlotBuffer(slot);
+            off_t offset = GetChunkOffset(chunk);
+            size_t total = 0;
+
+            // Whole chunks are requested even past the end of the region, to keep direct IO aligned.
+            while (total < m_chunkSize)
+            {
+                ssize_t res = m_file.ReadAt(buffer + total, m_chunkSize - total, offset + (off_t)total);
+                if (res < 0)
+                {
+                    return res;
+                }
+                else if (res == 0)
+                {
+                    break;
+                }
+
+                total += (size_t)res;
+            }
+
+            size_t remaining = (size_t)(m_end - offset);
+            return (ssize_t)((total < remaining) ? total : remaining);
+        }
+
+        void Work()
+        {
+            size_t slot;
+
+            pthread_mutex_lock(&m_lock);
+
+            while ((m_error == 0) && (m_nextChunk < m_chunkCount))
+            {
+                if (!m_free.Pop(slot))
+                {
+                    pthread_cond_wait(&m_changed, &m_lock);
+                    continue;
+                }
+
+                size_t chunk = m_nextChunk++;
+                pthread_mutex_unlock(&m_lock);
+
+                ssize_t res = ReadChunk(slot, chunk);
+
+                pthread_mutex_lock(&m_lock);
+
+                if (res < 0)
+                {
+                    SetError((int)res);
+                    m_free.Push(slot);
+                    pthread_cond_broadcast(&m_changed);
+                    continue;
+                }
+
+                m_slots[slot].chunk = chunk;
+                m_slots[slot].length = (size_t)res;
+                m_slots[slot].isReady = true;
+
+                if (m_order == EChunkOrder::AnyOrder)
+                {
+                    Deliver(slot);
+                }
+                else
+                {
+                    DeliverInOrder();
+                }
+            }
+
+            pthread_cond_broadcast(&m_changed);
+            pthread_mutex_unlock(&m_lock);
+        }
+
+        /**
+         * Hands a ready slot to the handler, and frees it. Called with the lock held.
+         */
+        void Deliver(size_t slot)
+        {
+            pthread_mutex_unlock(&m_lock);
+            int err = m_handler(m_context, GetChunkOffset(m_slots[slot].chunk),
+                                const_membuf(GetSlotBuffer(slot), m_slots[slot].length));
+            pthread_mutex_lock(&m_lock);
+
+            if (err != 0)
+            {
+                SetError(err);
+            }
+
+            m_slots[slot].isReady = false;
+            m_free.Push(slot);
+            pthread_cond_broadcast(&m_changed);
+        }
+
+        /**
+         * Delivers ready chunks for as long as the next chunk in order is ready. Called with the lock held.
+         * Only one thread delivers at a time; the others leave their chunks to it.
+         */
+        void DeliverInOrder()
+        {
+            if (m_isDelivering)
+            {
+                return;
+            }
+
+            m_isDelivering = true;
+
+            while (m_error == 0)
+            {
+                size_t slot = 0;
+
+                while ((slot < m_slotCount) &&
+                       !(m_slots[slot].isReady && (m_slots[slot].chunk == m_nextDelivery)))
+                {
+                    slot++;
+                }
+
+                if (slot == m_slotCount)
+                {
+                    break;
+                }
+
+                m_nextDelivery++;
+                Deliver(slot);
+            }
+
+            m_isDelivering = false;
+        }
+
+        File &m_file;
+        unsigned char *const m_storage;
+        const size_t m_chunkSize;
+        size_t m_slotCount;
+
+        pthread_mutex_t m_lock;
+        pthread_cond_t m_changed;
+        Slot m_slots[Slots];
+        Stack<size_t, Slots> m_free;
+
+        off_t m_start;
+        off_t m_end;
+        size_t m_chunkCount;
+        size_t m_nextChunk;
+        size_t m_nextDelivery;
+        bool m_isDelivering;
+        int m_error;
+
+        ChunkHandler m_handler;
+        void *m_context;
+        EChunkOrder m_order;
+    };
+}
+
+#endif //KRAKEN_PARALLELREADER_H
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file PinnedRegion.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_PINNEDREGION_H
+#define KRAKEN_PINNEDREGION_H
+
+#include <Kraken/IO/MemoryMapping.h>
+
+namespace Kraken
+{
+    /**
+     * The set of flags for `PinnedRegion::Open`.
+     */
+    enum class EPinnedRegionFlags
+    {
+        None = 0,
+
+        /**
+         * Try to back the region with reserved huge pages of `s_HugePageSize` (`MAP_HUGETLB | MAP_HUGE_2MB`).
+         */
+        HugeTLB = 1 << 0,
+
+        /**
+         * Ask for transparent huge pages (`MADV_HUGEPAGE`) when the region isn't backed by reserved ones.
+         */
+        TransparentHugePages = 1 << 1,
+
+        /**
+         * Lock the region in memory (`mlock`), so it is never swapped out.
+         */
+        Lock = 1 << 2,
+
+        /**
+         * Fault in all of the pages of the region up front.
+         */
+        Prefault = 1 << 3,
+
+        Default = HugeTLB | TransparentHugePages | Prefault,
+    };
+
+    ENUM_FLAGS(EPinnedRegionFlags);
+
+    /**
+     * A region of anonymous memory that is paid for up front - backed by huge pages when possible,
+     * optionally locked, and prefaulted - so buffers carved out of it suffer neither TLB misses
+     * nor first-touch page faults on the hot path.
+     *
+     * Buffers are handed out by bumping an offset, and are all released together by `Reset`.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class PinnedRegion
+    {
+    public:
+        /**
+         * The size of the huge pages the region's length is rounded to.
+         */
+        static constexpr size_t s_HugePageSize = 2 << 20;
+
+        PinnedRegion() :
+                m_offset(0),
+                m_isHugeTLB(false)
+        {}
+
+        /**
+         * Maps the region.
+         *
+         * @param length    The minimal length of the region, in bytes. Rounded up to `s_HugePageSize`.
+         * @param flags     How to back and prepare the region.
+         *
+         * @note With `Prefault`, the pages are populated with `MADV_POPULATE_WRITE`, and touched one by one
+         *          only on kernels that don't support it (before 5.14). If populating fails (e.g. `-ENOMEM`,
+         *          or `-EFAULT` when reserved huge pages run out), the region is unmapped and the error returned.
+         *
+         * @return `0` on success; `-EBUSY` if the region is already open; `-errno` on error.
+         */
+        int Open(size_t length, EPinnedRegionFlags flags = EPinnedRegionFlags::Default);
+
+        /**
+         * Carves a buffer out of the region.
+         *
+         * @param length    The length of the buffer, in bytes.
+         * @param alignment The alignment of the buffer's address. Must be a power of two.
+         *
+         * @return The buffer; an empty `membuf` (with a null address) if the region is exhausted.
+         */
+        membuf Allocate(size_t length, size_t alignment = 64);
+
+        /**
+         * Releases all of the buffers carved out of the region. The memory stays mapped and faulted in.
+         */
+        inline void Reset()
+        {
+            m_offset = 0;
+        }
+
+        /**
+         * Unmaps the region, if it is open.
+         */
+        void Close();
+
+        /**
+         * @return `true` if the region is mapped.
+         */
+        inline bool IsOpen() const
+        {
+            return m_mapping.IsMapped();
+        }
+
+        /**
+         * @return `true` if the region is backed by reserved huge pages, rather than by regular (or transparent huge) pages.
+         */
+        inline bool IsHugeTLB() const
+        {
+            return m_isHugeTLB;
+        }
+
+        /**
+         * @return The length of the region, in bytes.
+         */
+        inline size_t GetLength() const
+        {
+            return m_mapping.GetLength();
+        }
+
+        /**
+         * @return The amount of bytes that were not handed out yet.
+         */
+        inline size_t GetAvailable() const
+        {
+            return m_mapping.GetLength() - m_offset;
+        }
+
+    private:
+        PinnedRegion(const PinnedRegion &) = delete;
+
+        int Prefault();
+
+        /**
+         * Maps `length` bytes of regular pages, starting at a huge-page-aligned address.
+         */
+        int MapHugePageAligned(size_t length);
+
+        MemoryMapping m_mapping;
+        size_t m_offset;
+        bool m_isHugeTLB;
+    };
+}
+
+#endif //KRAKEN_PINNEDREGION_H
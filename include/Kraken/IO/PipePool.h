@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file PipePool.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_PIPEPOOL_H
+#define KRAKEN_PIPEPOOL_H
+
+#include <Kraken/IO/File.h>
+#include <Kraken/MetaSquid.h>
+#include <Kraken/Stack.h>
+#include <stdint.h>
+
+namespace Kraken
+{
+    /**
+     * The two ends of a pipe.
+     */
+    struct PipePair
+    {
+        File readEnd;
+        File writeEnd;
+    };
+
+    /**
+     * A fixed set of pre-created, pre-sized pipes, handed out for splice relays
+     * (e.g. socket -> pipe -> socket) instead of creating a pipe per transfer.
+     *
+     * @note Not thread-safe.
+     *
+     * @tparam N    The amount of pipes in the pool.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <size_t N>
+    class PipePool
+    {
+        static_assert(N > 0, "N must be positive.");
+
+    public:
+        PipePool() :
+                m_isOpen(false),
+                m_capacity(0),
+                m_flags(EFileFlags::None)
+        {
+            for (size_t index = 0; index < N; index++)
+            {
+                m_isInUse[index] = false;
+            }
+        }
+
+        /**
+         * Creates the pipes of the pool.
+         *
+         * @param capacity  The capacity of each pipe, in bytes. `0` keeps the default capacity.
+         * @param flags     Pipe creation flags. See `File::Pipe`.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(size_t capacity, EFileFlags flags = EFileFlags::CloseOnExec | EFileFlags::NonBlock)
+        {
+            int err;
+
+            if (m_isOpen)
+            {
+                KRAKEN_PRINT("Pool is already open.");
+                return -EBUSY;
+            }
+
+            m_capacity = capacity;
+            m_flags = flags;
+
+            for (size_t index = 0; index < N; index++)
+            {
+                err = OpenPipe(m_pipes[index]);
+                if (err != 0)
+                {
+                    Close();
+                    return err;
+                }
+
+                m_free.Push(index);
+            }
+
+            m_isOpen = true;
+            return 0;
+        }
+
+        /**
+         * Takes a pipe out of the pool.
+         *
+         * @return A pipe; `nullptr` if all of the pipes are in use.
+         */
+        PipePair *Acquire()
+        {
+            size_t index;
+
+            if (!m_free.Pop(index))
+            {
+                return nullptr;
+            }
+
+            m_isInUse[index] = true;
+            return &m_pipes[index];
+        }
+
+        /**
+         * Returns a pipe to the pool.
+         * A pipe that still holds data is replaced with a fresh one.
+         *
+         * @param pipe  A pipe previously returned by `Acquire`.
+         *
+         * @return `0` on success; `-EINVAL` if the pipe isn't currently acquired from the pool
+         *          (a foreign pipe, a double release, or a release after `Close`);
+         *          `-errno` if the pipe had to be replaced and that failed (the pipe is dropped from the pool).
+         */
+        int Release(PipePair *pipe)
+        {
+            size_t pending = 0;
+            size_t index;
+            int err;
+
+            // Relational comparisons between unrelated pointers are unspecified; compare addresses instead.
+            uintptr_t offset = (uintptr_t)pipe - (uintptr_t)m_pipes;
+            if ((offset >= sizeof(m_pipes)) || ((offset % sizeof(PipePair)) != 0))
+            {
+                KRAKEN_PRINT("Pipe doesn't belong to the pool.");
+                return -EINVAL;
+            }
+
+            index = offset / sizeof(PipePair);
+            if (!m_isInUse[index])
+            {
+                KRAKEN_PRINT("Pipe isn't acquired.");
+                return -EINVAL;
+            }
+
+            m_isInUse[index] = false;
+
+            err = pipe->readEnd.GetPendingLength(pending);
+            if ((err != 0) || (pending > 0))
+            {
+                pipe->readEnd.Close();
+                pipe->writeEnd.Close();
+
+                err = OpenPipe(*pipe);
+                if (err != 0)
+                {
+                    return err;
+                }
+            }
+
+            if (!m_free.Push(index))
+            {
+                KRAKEN_PRINT("Free list is full.");
+                return -ENOBUFS;
+            }
+
+            return 0;
+        }
+
+        /**
+         * @return `true` if the pool is open.
+         */
+        inline bool IsOpen() const
+        {
+            return m_isOpen;
+        }
+
+        /**
+         * @return The amount of pipes that can be acquired.
+         */
+        inline size_t Available() const
+        {
+            return m_free.Count();
+        }
+
+        /**
+         * Closes all of the pipes. Pipes that are in use must not be used (or released) afterwards.
+         */
+        void Close()
+        {
+            size_t index;
+
+            while (m_free.Pop(index)) {}
+            m_isOpen = false;
+
+            for (index = 0; index < N; index++)
+            {
+                m_isInUse[index] = false;
+
+                if (m_pipes[index].readEnd.IsOpen())
+                {
+                    m_pipes[index].readEnd.Close();
+                }
+
+                if (m_pipes[index].writeEnd.IsOpen())
+                {
+                    m_pipes[index].writeEnd.Close();
+                }
+            }
+        }
+
+    private:
+        int OpenPipe(PipePair &o_pipe)
+        {
+            int err = File::Pipe(o_pipe.readEnd, o_pipe.writeEnd, m_flags);
+            if ((err == 0) && (m_capacity > 0))
+            {
+                err = o_pipe.writeEnd.SetPipeCapacity(m_capacity);
+                if (err != 0)
+                {
+                    o_pipe.readEnd.Close();
+                    o_pipe.writeEnd.Close();
+                }
+            }
+
+            return err;
+        }
+
+        PipePool(const PipePool &) = delete;
+
+        PipePair m_pipes[N];
+        Stack<size_t, N> m_free;
+        bool m_isInUse[N];
+        bool m_isOpen;
+        size_t m_capacity;
+        EFileFlags m_flags;
+    };
+}
+
+#endif //KRAKEN_PIPEPOOL_H
@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file RecordReader.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_RECORDREADER_H
+#define KRAKEN_RECORDREADER_H
+
+#include <Kraken/ByteScan.h>
+#include <Kraken/Definitions.h>
+#include <Kraken/IO/IStream.h>
+#include <errno.h>
+#include <string.h>
+
+namespace Kraken
+{
+    /**
+     * Splits a stream into delimited records (lines, CRLF-terminated lines, ...), using vectorized scanning.
+     *
+     * Records are returned as views into an internal buffer of `N` bytes, and are never copied;
+     * only the incomplete tail of the buffer is moved to its start before the next read from the stream.
+     *
+     * @tparam N    The size of the internal buffer, in bytes. Records longer than this are returned in fragments.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    template <size_t N>
+    class RecordReader
+    {
+        static_assert(N > 1, "N must be larger than 1.");
+
+    public:
+        /**
+         * Constructs a reader of records ending with a single byte.
+         *
+         * @param stream    The stream to read from. Must outlive the reader.
+         * @param delimiter The byte ending each record.
+         */
+        RecordReader(IStream &stream, unsigned char delimiter = '\n') :
+                RecordReader(stream, delimiter, 0, 1)
+        {}
+
+        /**
+         * Constructs a reader of records ending with a two-byte sequence, such as CRLF (`'\r', '\n'`).
+         *
+         * @param stream    The stream to read from. Must outlive the reader.
+         * @param first     The first byte of the delimiter.
+         * @param second    The second byte of the delimiter.
+         */
+        RecordReader(IStream &stream, unsigned char first, unsigned char second) :
+                RecordReader(stream, first, second, 2)
+        {}
+
+        /**
+         * Advances to the next record. A final record without a delimiter is returned as well.
+         *
+         * @return `0` if a record is available through `GetRecord`; `-ENODATA` at the end of the stream;
+         *          `-ENOBUFS` if the record is longer than the buffer - `GetRecord` holds its first `N` bytes,
+         *          and the next call continues with the rest of it; `-errno` on error.
+         */
+        int Next()
+        {
+            while (true)
+            {
+                // Skip what was already scanned, but rescan a byte that might start a two-byte delimiter.
+                size_t scanStart = (m_scanned > m_start) ? m_scanned : m_start;
+                const unsigned char *found = Find(m_buffer + scanStart, m_end - scanStart);
+
+                if (found != nullptr)
+                {
+                    SetRecord(m_start, (size_t)(found - m_buffer));
+                    m_start = m_recordOffset + m_recordLength + m_delimiterLength;
+                    m_scanned = m_start;
+                    return 0;
+                }
+
+                m_scanned = (m_end - m_start >= m_delimiterLength) ? (m_end - m_delimiterLength + 1) : m_start;
+
+                if (m_isEndOfStream)
+                {
+                    if (m_start == m_end)
+                    {
+                        return -ENODATA;
+                    }
+
+                    SetRecord(m_start, m_end);
+                    m_start = m_end;
+                    return 0;
+                }
+
+                Compact();
+
+                if (m_end == N)
+                {
+                    SetRecord(0, N);
+                    m_start = N;
+                    return -ENOBUFS;
+                }
+
+                ssize_t res = m_stream.Read(m_buffer + m_end, N - m_end);
+                if (res < 0)
+                {
+                    return (int)res;
+                }
+                else if (res == 0)
+                {
+                    m_isEndOfStream = true;
+                }
+
+                m_end += (size_t)res;
+            }
+        }
+
+        /**
+         * Returns a view of the current record, without its delimiter.
+         *
+         * @note The view is invalidated by the next call to `Next`.
+         */
+        inline const_membuf GetRecord() const
+        {
+            return const_membuf(m_buffer + m_recordOffset, m_recordLength);
+        }
+
+        /**
+         * @return The size of the internal buffer.
+         */
+        constexpr size_t Capacity() const
+        {
+            return N;
+        }
+
+    private:
+        RecordReader(IStream &stream, unsigned char first, unsigned char second, size_t delimiterLength) :
+                m_stream(stream),
+                m_first(first),
+                m_second(second),
+                m_delimiterLength(delimiterLength),
+                m_start(0),
+                m_end(0),
+                m_scanned(0),
+                m_recordOffset(0),
+                m_recordLength(0),
+                m_isEndOfStream(false)
+        {}
+
+        RecordReader(const RecordReader &) = delete;
+
+        inline const unsigned char *Find(const unsigned char *data, size_t length) const
+        {
+            if (m_delimiterLength == 1)
+            {
+                return (const unsigned char *)FindByte(data, length, m_first);
+            }
+
+            return (const unsigned char *)FindBytePair(data, length, m_first, m_second);
+        }
+
+        inline void SetRecord(size_t start, size_t end)
+        {
+            m_recordOffset = start;
+            m_recordLength = end - start;
+        }
+
+        /**
+         * Moves the incomplete tail to the start of the buffer.
+         */
+        void Compact()
+        {
+            if (m_start == 0)
+            {
+                return;
+            }
+
+            memmove(m_buffer, m_buffer + m_start, m_end - m_start);
+            m_end -= m_start;
+            m_scanned -= m_start;
+            m_start = 0;
+        }
+
+        IStream &m_stream;
+        const unsigned char m_first;
+        const unsigned char m_second;
+        const size_t m_delimiterLength;
+        size_t m_start;
+        size_t m_end;
+        size_t m_scanned;
+        size_t m_recordOffset;
+        size_t m_recordLength;
+        bool m_isEndOfStream;
+        unsigned char m_buffer[N];
+    };
+}
+
+#endif //KRAKEN_RECORDREADER_H
@@ -30,6 +30,10 @@
 
 #include <Kraken/IO/File.h>
 #include <Kraken/IO/Address.h>
+#include <Kraken/IO/SocketOptions.h>
+#include <Kraken/IO/ControlMessage.h>
+#include <linux/errqueue.h>
+#include <unistd.h>
 
 namespace Kraken
 {
@@ -41,6 +45,31 @@ namespace Kraken
         Datagram = SOCK_DGRAM,
         SeqPacket = SOCK_SEQPACKET,
         Stream = SOCK_STREAM,
+
+        /**
+         * Whole frames, including the link-layer header (packet sockets).
+         */
+        Raw = SOCK_RAW,
+    };
+
+    /**
+     * The set of flags for `Socket::Open`.
+     */
+    enum class ESocketFlags
+    {
+        None = 0,
+        CloseOnExec = SOCK_CLOEXEC,
+        NonBlock = SOCK_NONBLOCK,
+    };
+
+    /**
+     * The set of flags for the descriptors returned by `Socket::Accept`.
+     */
+    enum class EAcceptFlags
+    {
+        None = 0,
+        CloseOnExec = SOCK_CLOEXEC,
+        NonBlock = SOCK_NONBLOCK,
     };
 
     enum class ESendFlags
@@ -54,6 +83,11 @@ namespace Kraken
         NoSignal = MSG_NOSIGNAL,
         OutOfBand = MSG_OOB,
 
+        /**
+         * Transmit from the user's pages instead of copying them (see `Socket::SendZeroCopy`).
+         */
+        ZeroCopy = MSG_ZEROCOPY,
+
         // Aliases
         NonBlock = DoNotWait,
     };
@@ -62,19 +96,117 @@ namespace Kraken
     {
         None = 0,
         DoNotWait = MSG_DONTWAIT,
-        MSG_ERRQUEUE,
-        MSG_OOB,
-        MSG_PEEK,
-        MSG_TRUNC,
-        MSG_WAITALL,
+        ErrorQueue = MSG_ERRQUEUE,
+        OutOfBand = MSG_OOB,
+        Peek = MSG_PEEK,
+        Truncate = MSG_TRUNC,
+        WaitAll = MSG_WAITALL,
+
+        /**
+         * Used by `ReceiveBatch`: blocks only until the first message arrives.
+         */
+        WaitForOne = MSG_WAITFORONE,
 
         // Aliases
         NonBlock = DoNotWait
     };
 
+    ENUM_FLAGS(ESocketFlags);
+    ENUM_FLAGS(EAcceptFlags);
     ENUM_FLAGS(ESendFlags);
     ENUM_FLAGS(EReceiveFlags);
 
+    /**
+     * A range of zero-copy sends that the kernel is done with (see `Socket::SendZeroCopy`).
+     * The buffers of these sends may be reused.
+     */
+    struct ZeroCopyCompletion
+    {
+        /**
+         * The id of the first completed send.
+         */
+        uint32_t first;
+
+        /**
+         * The id of the last completed send (inclusive).
+         */
+        uint32_t last;
+
+        /**
+         * `true` if the kernel fell back to copying the data (e.g. over loopback),
+         * in which case zero-copy only added overhead.
+         */
+        bool isCopied;
+    };
+
+    /**
+     * The point in a packet's transmission at which a timestamp was taken.
+     */
+    enum class ETimestampType
+    {
+        Sent = SCM_TSTAMP_SND,
+        Scheduled = SCM_TSTAMP_SCHED,
+        Acknowledged = SCM_TSTAMP_ACK,
+    };
+
+    /**
+     * A transmit timestamp, read from the error queue (see `Socket::ReadTransmitTimestamps`).
+     */
+    struct TransmitTimestamp
+    {
+        /**
+         * The number of the send (or of the last byte, for TCP), when `ETimestampingFlags::Id` is enabled.
+         */
+        uint32_t id;
+
+        /**
+         * The point of transmission the timestamp was taken at.
+         */
+        ETimestampType type;
+
+        /**
+         * The time (`CLOCK_REALTIME`) the timestamp was taken at.
+         */
+        struct timespec time;
+    };
+
+    /**
+     * The kind of a message read from a socket's error queue.
+     */
+    enum class EErrorQueueMessageType
+    {
+        ZeroCopyCompletion,
+        TransmitTimestamp,
+        Error,
+    };
+
+    /**
+     * A message read from a socket's error queue (see `Socket::ReadErrorQueue`).
+     */
+    struct ErrorQueueMessage
+    {
+        EErrorQueueMessageType type;
+
+        union
+        {
+            /**
+             * Valid for `EErrorQueueMessageType::ZeroCopyCompletion`.
+             */
+            ZeroCopyCompletion completion;
+
+            /**
+             * Valid for `EErrorQueueMessageType::TransmitTimestamp`.
+             */
+            TransmitTimestamp timestamp;
+
+            /**
+             * Valid for `EErrorQueueMessageType::Error`: an error queued by the network
+             * (e.g. ICMP, with `IP_RECVERR`). `ee_errno` holds its errno value.
+             */
+            struct sock_extended_err error;
+        };
+    };
+
     /**
      * A templated socket wrapper.
      *
@@ -83,11 +215,35 @@ namespace Kraken
      * @see @ref Address<ESocketDomain::Unix>
      * @see @ref Address<ESocketDomain::IPv4>
      * @see @ref Address<ESocketDomain::IPv6>
+     * @see @ref Address<ESocketDomain::Packet>
      */
     template <ESocketDomain D>
     class Socket : public File
     {
     public:
+        /**
+         * Construct a default, non-open socket.
+         */
+        Socket() :
+                m_zeroCopySequence(0),
+                m_isZeroCopyEnabled(false),
+                m_hasPendingErrorMessage(false)
+        {}
+
+        /**
+         * Construct a socket around an open socket descriptor (e.g. one returned by an asynchronous accept).
+         *
+         * @note This does not disable RAII; the descriptor will be shut down when the object goes out of scope.
+         *
+         * @param descriptor The socket descriptor to use.
+         */
+        Socket(fd_t descriptor) :
+                File(descriptor),
+                m_zeroCopySequence(0),
+                m_isZeroCopyEnabled(false),
+                m_hasPendingErrorMessage(false)
+        {}
+
         virtual ~Socket()
         {
             if (IsOpen())
@@ -111,9 +267,26 @@ namespace Kraken
          * Creates a new socket object.
          *
          * @param type  The communication protocol type.
+         * @param flags Flags of the new descriptor.
+         * @return `0` on success; `-errno` otherwise.
+         */
+        inline int Open(ESocketType type, ESocketFlags flags = ESocketFlags::None)
+        {
+            return Open(type, 0, flags);
+        }
+
+        /**
+         * Creates a new socket object of a specific protocol.
+         *
+         * @note A packet socket opened with protocol `0` receives nothing until it is bound;
+         *          this lets rings and fanout be set up before any frame arrives.
+         *
+         * @param type      The communication protocol type.
+         * @param protocol  The protocol, as `socket` expects it (the ethertype in network byte order, for packet sockets).
+         * @param flags     Flags of the new descriptor.
          * @return `0` on success; `-errno` otherwise.
          */
-        int Open(ESocketType type)
+        int Open(ESocketType type, int protocol, ESocketFlags flags = ESocketFlags::None)
         {
             int descriptor;
 
@@ -122,13 +295,16 @@ namespace Kraken
                 return -EBUSY;
             }
 
-            descriptor = socket((int)D, (int)type, 0);
+            descriptor = socket((int)D, (int)type | (int)flags, protocol);
             if (descriptor < 0)
             {
                 return -errno;
             }
 
             m_descriptor = descriptor;
+            m_zeroCopySequence = 0;
+            m_isZeroCopyEnabled = false;
+            m_hasPendingErrorMessage = false;
 
             return 0;
         }
@@ -152,7 +328,7 @@ namespace Kraken
             err = bind(m_descriptor, localAddress.GetBase(), localAddress.GetLength());
             if (err != 0)
             {
-                KRAKEN_PRINT("Bind error. errno = %d", res);
+                KRAKEN_PRINT("Bind error. errno = %d", errno);
                 return -errno;
             }
 
@@ -203,13 +379,13 @@ namespace Kraken
          *
          * @note The o_client object must *not* contain a valid descriptor. In such case, `-EBUSY` will be returned.
          *
-         * @param o_client A Socket object to be initialized as the client.
+         * @param o_client  A Socket object to be initialized as the client.
+         * @param flags     Flags of the client's descriptor.
          * @return `0` on success; `-errno` on error.
          */
-        int Accept(Socket &o_client)
+        inline int Accept(Socket &o_client, EAcceptFlags flags = EAcceptFlags::None)
         {
-            Address<D> wastefulImplementationDetail;
-            return Accept(o_client, wastefulImplementationDetail);
+            return Accept(o_client, nullptr, flags);
         }
 
         /**
@@ -219,28 +395,63 @@ namespace Kraken
          *
          * @param o_client          A Socket object to be initialized as the client.
          * @param o_clientAddress   An address object to be filled by the connection source's address.
+         * @param flags             Flags of the client's descriptor.
          * @return `0` on success; `-errno` on error.
          */
-        int Accept(Socket &o_client, Address<D> &o_clientAddress)
+        inline int Accept(Socket &o_client, Address<D> &o_clientAddress, EAcceptFlags flags = EAcceptFlags::None)
         {
-            int descriptor;
-            socklen_t addressLength = Address<D>::s_MaxSize;
+            return Accept(o_client, &o_clientAddress, flags);
+        }
 
-            if (o_client.IsOpen())
+        /**
+         * Accepts pending connections until the backlog is drained, or until all of `o_clients` are used.
+         *
+         * @note The listener should be non-blocking (`ESocketFlags::NonBlock`); otherwise, the call blocks
+         *          once the backlog is drained.
+         * @note None of the `o_clients` objects may contain a valid descriptor. In such case, `-EBUSY` will be returned.
+         *
+         * @tparam N    The maximal amount of connections to accept.
+         *
+         * @param o_clients Socket objects to be initialized as the clients, in order.
+         * @param flags     Flags of the clients' descriptors.
+         * @return The amount of accepted connections (`0` if none were pending); `-errno` on error.
+         */
+        template <size_t N>
+        int AcceptBatch(Socket (&o_clients)[N], EAcceptFlags flags = EAcceptFlags::None)
+        {
+            size_t count = 0;
+
+            for (size_t index = 0; index < N; index++)
             {
-                return -EBUSY;
+                if (o_clients[index].IsOpen())
+                {
+                    return -EBUSY;
+                }
             }
 
-            descriptor = accept(m_descriptor, o_clientAddress.GetBase(), &addressLength);
-            if (descriptor < 0)
+            while (count < N)
             {
-                return -errno;
+                int err = Accept(o_clients[count], nullptr, flags);
+                if (err == 0)
+                {
+                    count++;
+                }
+                else if (err == -ECONNABORTED)
+                {
+                    // The connection was reset while queued; the rest of the backlog is unaffected.
+                    continue;
+                }
+                else if ((err == -EAGAIN) || (count > 0))
+                {
+                    break;
+                }
+                else
+                {
+                    return err;
+                }
             }
 
-            o_clientAddress.SetLength(addressLength);
-            o_client.m_descriptor = descriptor;
-
-            return 0;
+            return (int)count;
         }
 
         /**
@@ -405,42 +616,1193 @@ namespace Kraken
             return Receive(o_mem.buffer, o_mem.length, o_senderAddress, flags);
         }
 
-    public:
         /**
-         * Creates a pair of connected sockets.
+         * Sets a socket option.
          *
-         * @param type          The domain of the created sockets.
-         * @param o_socket1     A reference to a non-opened socket object.
-         * @param o_socket2     A reference to a non-opened socket object.
+         * @tparam Option   The option to set, from `SocketOption`.
+         *
+         * @param value The new value of the option.
          * @return `0` on success; `-errno` on error.
          */
-        static int Pair(ESocketType type, Socket &o_socket1, Socket &o_socket2)
+        template <typename Option>
+        int SetOption(const typename Option::ValueType &value)
         {
-            int fds[2] = {-EBADFD, -EBADFD};
-            int sockErr = 0;
+            static_assert(Option::IsApplicable(D), "The option does not apply to this socket domain.");
+            static_assert(Option::IsWritable(), "The option is read-only.");
+            typename Option::NativeType native = (typename Option::NativeType)value;
 
-            if (o_socket1.IsOpen() || o_socket2.IsOpen())
+            if (setsockopt(m_descriptor, Option::s_Level, Option::s_Name, &native, sizeof(native)) != 0)
             {
-                return -EBUSY;
+                KRAKEN_PRINT("setsockopt(%d, %d) failed. errno = %d", Option::s_Level, Option::s_Name, errno);
+                return -errno;
             }
 
-            sockErr = socketpair((int)D, (int)type, 0, fds);
-            if (sockErr != 0)
+            return 0;
+        }
+
+        /**
+         * Reads a socket option.
+         *
+         * @tparam Option   The option to read, from `SocketOption`.
+         *
+         * @param o_value   Filled with the value of the option.
+         * @return `0` on success; `-errno` on error.
+         */
+        template <typename Option>
+        int GetOption(typename Option::ValueType &o_value) const
+        {
+            static_assert(Option::IsApplicable(D), "The option does not apply to this socket domain.");
+            static_assert(Option::IsReadable(), "The option is write-only.");
+            typename Option::NativeType native;
+            socklen_t length = sizeof(native);
+
+            memset(&native, 0, sizeof(native));
+
+            if (getsockopt(m_descriptor, Option::s_Level, Option::s_Name, &native, &length) != 0)
             {
+                KRAKEN_PRINT("getsockopt(%d, %d) failed. errno = %d", Option::s_Level, Option::s_Name, errno);
                 return -errno;
             }
 
-            o_socket1.m_descriptor = fds[0];
-            o_socket2.m_descriptor = fds[1];
+            o_value = (typename Option::ValueType)native;
+            return 0;
+        }
+
+        /**
+         * Allows zero-copy sends on the socket (`SO_ZEROCOPY`).
+         * Called implicitly by the first `SendZeroCopy`.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        int EnableZeroCopy()
+        {
+            if (m_isZeroCopyEnabled)
+            {
+                return 0;
+            }
+
+            int err = SetOption<SocketOption::ZeroCopy>(true);
+            if (err != 0)
+            {
+                return err;
+            }
 
+            m_isZeroCopyEnabled = true;
             return 0;
         }
+
+        /**
+         * Sends a buffer without copying it into the kernel (`MSG_ZEROCOPY`).
+         *
+         * @note The buffer must not be modified or freed until a completion covering `o_id`
+         *          is read by `ReadZeroCopyCompletions`.
+         * @note Worthwhile for large buffers (roughly 10KB and up); page pinning costs more than copying small ones.
+         *
+         * @param buffer    The buffer to send.
+         * @param length    The length of the buffer.
+         * @param o_id      Filled with the id of the send, on success.
+         * @param flags     Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        ssize_t SendZeroCopy(const void *buffer, size_t length, uint32_t &o_id, ESendFlags flags = ESendFlags::None)
+        {
+            int err = EnableZeroCopy();
+            if (err != 0)
+            {
+                return err;
+            }
+
+            ssize_t bytesSent = Send(buffer, length, flags | ESendFlags::ZeroCopy);
+            if (bytesSent < 0)
+            {
+                return bytesSent;
+            }
+
+            // The kernel numbers every successful zero-copy send, starting at 0.
+            o_id = m_zeroCopySequence++;
+            return bytesSent;
+        }
+
+        /**
+         * Sends a membuf without copying it into the kernel (`MSG_ZEROCOPY`).
+         *
+         * @param mem   The buffer to send.
+         * @param o_id  Filled with the id of the send, on success.
+         * @param flags Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        inline ssize_t SendZeroCopy(const_membuf mem, uint32_t &o_id, ESendFlags flags = ESendFlags::None)
+        {
+            return SendZeroCopy(mem.buffer, mem.length, o_id, flags);
+        }
+
+        /**
+         * Reads pending messages from the socket's error queue, without blocking: zero-copy completions,
+         * transmit timestamps and errors queued by the network, in the order they were queued.
+         * The socket reports `EPOLLERR` while messages are pending.
+         *
+         * @note Use this rather than `ReadZeroCopyCompletions` and `ReadTransmitTimestamps` when a socket
+         *          queues more than one kind of message; the error queue can't be peeked.
+         *
+         * @tparam N    The maximal amount of messages to read.
+         *
+         * @param o_messages    Filled with the messages.
+         * @return On success, the amount of messages read (`0` if none are pending); on error `-errno`.
+         */
+        template <size_t N>
+        int ReadErrorQueue(ErrorQueueMessage (&o_messages)[N])
+        {
+            size_t count = 0;
+
+            while (count < N)
+            {
+                int err = ReadErrorMessage(o_messages[count]);
+                if (err == -EAGAIN)
+                {
+                    break;
+                }
+                else if (err < 0)
+                {
+                    return (count > 0) ? (int)count : err;
+                }
+
+                count++;
+            }
+
+            return (int)count;
+        }
+
+        /**
+         * Reads pending zero-copy completions from the socket's error queue, without blocking.
+         * The socket reports `EPOLLERR` while completions are pending.
+         *
+         * @note Reading stops at a transmit timestamp, which is kept for `ReadTransmitTimestamps`
+         *          (or `ReadErrorQueue`); a queued error is returned as `-errno`.
+         *
+         * @tparam N    The maximal amount of completions to read.
+         *
+         * @param o_completions Filled with the completed ranges of send ids.
+         * @return On success, the amount of completions read (`0` if none are pending); on error `-errno`.
+         */
+        template <size_t N>
+        inline int ReadZeroCopyCompletions(ZeroCopyCompletion (&o_completions)[N])
+        {
+            return ReadErrorQueueOf<EErrorQueueMessageType::ZeroCopyCompletion>(o_completions, &ErrorQueueMessage::completion);
+        }
+
+        /**
+         * Joins (or creates) a fanout group (`PACKET_FANOUT`), spreading the frames the group captures
+         * between its sockets - typically one per capturing thread.
+         *
+         * @note The socket must be bound first; all of the group's sockets must be bound alike and use the same mode.
+         *
+         * @param groupId   The id of the group, unique within the network namespace.
+         * @param mode      The policy picking the socket that receives each frame.
+         * @param flags     Fanout flags.
+         * @return `0` on success; `-errno` on error.
+         */
+        inline int JoinFanout(uint16_t groupId, EPacketFanoutMode mode,
+                              EPacketFanoutFlags flags = EPacketFanoutFlags::None)
+        {
+            static_assert(D == ESocketDomain::Packet, "Fanout requires a packet socket.");
+            return SetOption<SocketOption::PacketFanout>((int)groupId | (((int)mode | (int)flags) << 16));
+        }
+
+        /**
+         * Makes every send on this (UDP) socket be split into datagrams of `segmentSize` bytes (`UDP_SEGMENT`),
+         * so a single call sends many datagrams.
+         *
+         * @param segmentSize   The payload size of each datagram. `0` disables segmentation.
+         * @return `0` on success; `-errno` on error.
+         */
+        inline int SetSegmentSize(uint16_t segmentSize)
+        {
+            return SetOption<SocketOption::UdpSegment>(segmentSize);
+        }
+
+        /**
+         * Sends a buffer through a connected (UDP) socket as datagrams of `segmentSize` bytes each (`UDP_SEGMENT`).
+         * The last datagram may be shorter.
+         *
+         * @param buffer        The buffer to send. At most 64 segments.
+         * @param length        The length of the buffer.
+         * @param segmentSize   The payload size of each datagram.
+         * @param flags         Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        ssize_t SendSegmented(const void *buffer, size_t length, uint16_t segmentSize, ESendFlags flags = ESendFlags::None)
+        {
+            return SendSegmented(buffer, length, segmentSize, nullptr, flags);
+        }
+
+        /**
+         * Sends a buffer to the given destination as datagrams of `segmentSize` bytes each (`UDP_SEGMENT`).
+         * The last datagram may be shorter.
+         *
+         * @param buffer        The buffer to send. At most 64 segments.
+         * @param length        The length of the buffer.
+         * @param segmentSize   The payload size of each datagram.
+         * @param destination   The destination to send to.
+         * @param flags         Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        inline ssize_t SendSegmented(const void *buffer, size_t length, uint16_t segmentSize,
+                                     const Address<D> &destination, ESendFlags flags = ESendFlags::None)
+        {
+            return SendSegmented(buffer, length, segmentSize, &destination, flags);
+        }
+
+        /**
+         * Lets the kernel coalesce consecutive datagrams of the same flow into a single
+         * super-datagram (`UDP_GRO`), to be read with `ReceiveCoalesced`.
+         *
+         * @return `0` on success; `-errno` on error.
+         */
+        inline int EnableCoalescing()
+        {
+            return SetOption<SocketOption::UdpGro>(true);
+        }
+
+        /**
+         * Receives a (possibly coalesced) datagram, along with the size of the datagrams it is made of.
+         * Every `o_segmentSize` bytes of the data are a separate datagram; the last one may be shorter.
+         *
+         * @param o_buffer      The buffer to fill. Should fit 64KB, the maximal super-datagram.
+         * @param length        The length of the buffer.
+         * @param o_segmentSize Filled with the size of the original datagrams (the whole length, if not coalesced).
+         * @param flags         Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        ssize_t ReceiveCoalesced(void *o_buffer, size_t length, uint16_t &o_segmentSize,
+                                 EReceiveFlags flags = EReceiveFlags::None)
+        {
+            return ReceiveCoalesced(o_buffer, length, o_segmentSize, nullptr, flags);
+        }
+
+        /**
+         * Receives a (possibly coalesced) datagram, along with the size of the datagrams it is made of and their sender.
+         *
+         * @param o_buffer          The buffer to fill. Should fit 64KB, the maximal super-datagram.
+         * @param length            The length of the buffer.
+         * @param o_segmentSize     Filled with the size of the original datagrams (the whole length, if not coalesced).
+         * @param o_senderAddress   Filled with the sender's address.
+         * @param flags             Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        inline ssize_t ReceiveCoalesced(void *o_buffer, size_t length, uint16_t &o_segmentSize,
+                                        Address<D> &o_senderAddress, EReceiveFlags flags = EReceiveFlags::None)
+        {
+            return ReceiveCoalesced(o_buffer, length, o_segmentSize, &o_senderAddress, flags);
+        }
+
+        /**
+         * Sends open descriptors to the peer of a Unix socket (`SCM_RIGHTS`), along with some data.
+         * The peer receives duplicates of the descriptors; the files stay open here.
+         *
+         * @note A `Socket` handed off this way (e.g. an accepted connection passed to a worker) must be
+         *          released with `Close()` or `Detach()`. Destroying it, or calling `Shutdown()`, shuts
+         *          the connection down for the receiver as well.
+         *
+         * @tparam N    The amount of descriptors. At most 253 (`SCM_MAX_FD`).
+         *
+         * @param data  The data to send along. Must not be empty for stream sockets.
+         * @param files The files whose descriptors to send.
+         * @param flags Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        template <size_t N>
+        ssize_t SendDescriptors(const_membuf data, const File *const (&files)[N], ESendFlags flags = ESendFlags::None)
+        {
+            static_assert(D == ESocketDomain::Unix, "Descriptors can only be passed over Unix sockets.");
+            ControlBuffer<ControlSpace<fd_t, N>::value> control;
+            fd_t descriptors[N];
+
+            for (size_t index = 0; index < N; index++)
+            {
+                if ((files[index] == nullptr) || !files[index]->IsOpen())
+                {
+                    return -EBADF;
+                }
+
+                descriptors[index] = files[index]->GetFileDescriptor();
+            }
+
+            control.AddArray(SOL_SOCKET, SCM_RIGHTS, descriptors, N);
+
+            return SendWithControl(data.buffer, data.length, nullptr, control, flags);
+        }
+
+        /**
+         * Receives data along with descriptors sent by `SendDescriptors` (`SCM_RIGHTS`).
+         * The received descriptors are close-on-exec.
+         *
+         * @note Descriptors beyond the first `N` are closed by the kernel.
+         *
+         * @tparam N    The maximal amount of descriptors.
+         *
+         * @param o_data    The buffer to fill with the received data.
+         * @param o_files   Closed file objects, to be initialized with the received descriptors, in order.
+         * @param o_count   Filled with the amount of received descriptors.
+         * @param flags     Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        template <size_t N>
+        ssize_t ReceiveDescriptors(membuf o_data, File *const (&o_files)[N], size_t &o_count,
+                                   EReceiveFlags flags = EReceiveFlags::None)
+        {
+            static_assert(D == ESocketDomain::Unix, "Descriptors can only be passed over Unix sockets.");
+            ControlBuffer<ControlSpace<fd_t, N>::value> control;
+            ssize_t bytesReceived;
+
+            o_count = 0;
+
+            for (size_t index = 0; index < N; index++)
+            {
+                if ((o_files[index] == nullptr) || o_files[index]->IsOpen())
+                {
+                    return -EBUSY;
+                }
+            }
+
+            bytesReceived = ReceiveWithControl(o_data.buffer, o_data.length, nullptr, control, (int)flags | MSG_CMSG_CLOEXEC);
+            if (bytesReceived < 0)
+            {
+                return bytesReceived;
+            }
+
+            for (ControlMessage message : control.GetMessages())
+            {
+                if (message.Is(SOL_SOCKET, SCM_RIGHTS))
+                {
+                    fd_t descriptors[N];
+                    size_t count = message.GetArray(descriptors, N);
+
+                    for (size_t index = 0; index < count; index++)
+                    {
+                        Adopt(*o_files[o_count++], descriptors[index]);
+                    }
+                }
+            }
+
+            return bytesReceived;
+        }
+
+        /**
+         * Sends data along with the credentials of this process (`SCM_CREDENTIALS`).
+         *
+         * @note The peer only receives credentials if it enabled `SocketOption::PassCredentials`,
+         *          in which case the kernel attaches them to every message even without this call.
+         *
+         * @param data  The data to send along. Must not be empty for stream sockets.
+         * @param flags Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        ssize_t SendCredentials(const_membuf data, ESendFlags flags = ESendFlags::None)
+        {
+            static_assert(D == ESocketDomain::Unix, "Credentials can only be passed over Unix sockets.");
+            ControlBuffer<ControlSpace<struct ucred>::value> control;
+            struct ucred credentials;
+
+            credentials.pid = getpid();
+            credentials.uid = getuid();
+            credentials.gid = getgid();
+            control.Add(SOL_SOCKET, SCM_CREDENTIALS, credentials);
+
+            return SendWithControl(data.buffer, data.length, nullptr, control, flags);
+        }
+
+        /**
+         * Receives data along with the credentials of the sender (`SCM_CREDENTIALS`), as verified by the kernel.
+         * Requires `SocketOption::PassCredentials` to be enabled on this socket.
+         *
+         * @param o_data        The buffer to fill with the received data.
+         * @param o_credentials Filled with the sender's process, user and group ids;
+         *                      zeroed (`pid == 0`) if no credentials were attached.
+         * @param flags         Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        ssize_t ReceiveCredentials(membuf o_data, struct ucred &o_credentials, EReceiveFlags flags = EReceiveFlags::None)
+        {
+            static_assert(D == ESocketDomain::Unix, "Credentials can only be passed over Unix sockets.");
+            ControlBuffer<ControlSpace<struct ucred>::value> control;
+            ssize_t bytesReceived;
+
+            memset(&o_credentials, 0, sizeof(o_credentials));
+
+            bytesReceived = ReceiveWithControl(o_data.buffer, o_data.length, nullptr, control, (int)flags);
+            if (bytesReceived < 0)
+            {
+                return bytesReceived;
+            }
+
+            for (ControlMessage message : control.GetMessages())
+            {
+                if (message.Is(SOL_SOCKET, SCM_CREDENTIALS) && message.Get(o_credentials))
+                {
+                    break;
+                }
+            }
+
+            return bytesReceived;
+        }
+
+        /**
+         * Sends a message gathered from several buffers (`sendmsg`), e.g. a header and a body,
+         * without concatenating them first.
+         *
+         * @tparam N    The number of vectors.
+         *
+         * @param vectors   The buffers to send, in order.
+         * @param flags     Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        template <size_t N>
+        ssize_t SendMessage(const_membuf (&vectors)[N], ESendFlags flags = ESendFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return SendMessage(nativeVectors, N, nullptr, nullptr, 0, flags);
+        }
+
+        /**
+         * Sends a message gathered from several buffers to the given destination (`sendmsg`).
+         *
+         * @tparam N    The number of vectors.
+         *
+         * @param vectors       The buffers to send, in order.
+         * @param destination   The destination to send to.
+         * @param flags         Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        template <size_t N>
+        ssize_t SendMessage(const_membuf (&vectors)[N], const Address<D> &destination, ESendFlags flags = ESendFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return SendMessage(nativeVectors, N, &destination, nullptr, 0, flags);
+        }
+
+        /**
+         * Sends a message gathered from several buffers, along with control messages (`sendmsg`).
+         *
+         * @tparam N    The number of vectors.
+         * @tparam C    The capacity of the control buffer.
+         *
+         * @param vectors   The buffers to send, in order.
+         * @param control   The control messages to send.
+         * @param flags     Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        template <size_t N, size_t C>
+        ssize_t SendMessage(const_membuf (&vectors)[N], const ControlBuffer<C> &control, ESendFlags flags = ESendFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return SendMessage(nativeVectors, N, nullptr, control.GetData(), control.GetLength(), flags);
+        }
+
+        /**
+         * Sends a message gathered from several buffers to the given destination, along with control messages (`sendmsg`).
+         *
+         * @tparam N    The number of vectors.
+         * @tparam C    The capacity of the control buffer.
+         *
+         * @param vectors       The buffers to send, in order.
+         * @param destination   The destination to send to.
+         * @param control       The control messages to send.
+         * @param flags         Send flags.
+         * @return On success, the amount of bytes sent; on error `-errno`.
+         */
+        template <size_t N, size_t C>
+        ssize_t SendMessage(const_membuf (&vectors)[N], const Address<D> &destination, const ControlBuffer<C> &control,
+                            ESendFlags flags = ESendFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return SendMessage(nativeVectors, N, &destination, control.GetData(), control.GetLength(), flags);
+        }
+
+        /**
+         * Receives a message, scattered into several buffers (`recvmsg`).
+         *
+         * @tparam N    The number of vectors.
+         *
+         * @param vectors   The buffers to fill, in order.
+         * @param flags     Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        template <size_t N>
+        ssize_t ReceiveMessage(membuf (&vectors)[N], EReceiveFlags flags = EReceiveFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            size_t controlLength = 0;
+
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return ReceiveMessage(nativeVectors, N, nullptr, nullptr, controlLength, (int)flags);
+        }
+
+        /**
+         * Receives a message scattered into several buffers, along with the sender's address (`recvmsg`).
+         *
+         * @tparam N    The number of vectors.
+         *
+         * @param vectors           The buffers to fill, in order.
+         * @param o_senderAddress   Filled with the sender's address.
+         * @param flags             Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        template <size_t N>
+        ssize_t ReceiveMessage(membuf (&vectors)[N], Address<D> &o_senderAddress, EReceiveFlags flags = EReceiveFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            size_t controlLength = 0;
+
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            return ReceiveMessage(nativeVectors, N, &o_senderAddress, nullptr, controlLength, (int)flags);
+        }
+
+        /**
+         * Receives a message scattered into several buffers, along with its control messages (`recvmsg`).
+         *
+         * @tparam N    The number of vectors.
+         * @tparam C    The capacity of the control buffer.
+         *
+         * @param vectors   The buffers to fill, in order.
+         * @param o_control Filled with the received control messages. Iterate with `GetMessages`.
+         * @param flags     Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        template <size_t N, size_t C>
+        ssize_t ReceiveMessage(membuf (&vectors)[N], ControlBuffer<C> &o_control, EReceiveFlags flags = EReceiveFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            size_t controlLength = C;
+
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            ssize_t bytesReceived = ReceiveMessage(nativeVectors, N, nullptr, o_control.GetData(), controlLength, (int)flags);
+            o_control.SetLength(controlLength);
+
+            return bytesReceived;
+        }
+
+        /**
+         * Receives a message scattered into several buffers, along with the sender's address and control messages (`recvmsg`).
+         *
+         * @tparam N    The number of vectors.
+         * @tparam C    The capacity of the control buffer.
+         *
+         * @param vectors           The buffers to fill, in order.
+         * @param o_senderAddress   Filled with the sender's address.
+         * @param o_control         Filled with the received control messages. Iterate with `GetMessages`.
+         * @param flags             Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        template <size_t N, size_t C>
+        ssize_t ReceiveMessage(membuf (&vectors)[N], Address<D> &o_senderAddress, ControlBuffer<C> &o_control,
+                               EReceiveFlags flags = EReceiveFlags::None)
+        {
+            details::membuf_iovec_converter::iovec_type<N> nativeVectors;
+            size_t controlLength = C;
+
+            details::membuf_iovec_converter::copy(vectors, nativeVectors);
+
+            ssize_t bytesReceived = ReceiveMessage(nativeVectors, N, &o_senderAddress, o_control.GetData(),
+                                                   controlLength, (int)flags);
+            o_control.SetLength(controlLength);
+
+            return bytesReceived;
+        }
+
+        /**
+         * Receives data from the socket, along with the time it was received by the kernel.
+         * Requires `SocketOption::TimestampNanoseconds`, or `SocketOption::Timestamping` with
+         * `ETimestampingFlags::ReceiveSoftware | ETimestampingFlags::Software`.
+         *
+         * @param o_buffer      The buffer to fill with the received data.
+         * @param length        The length of the buffer.
+         * @param o_timestamp   Filled with the receive time (`CLOCK_REALTIME`); zero if no timestamp was attached.
+         * @param flags         Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        inline ssize_t ReceiveTimestamped(void *o_buffer, size_t length, struct timespec &o_timestamp,
+                                          EReceiveFlags flags = EReceiveFlags::None)
+        {
+            return ReceiveTimestamped(o_buffer, length, o_timestamp, nullptr, flags);
+        }
+
+        /**
+         * Receives data from the socket, along with the time it was received by the kernel and the sender's address.
+         *
+         * @param o_buffer          The buffer to fill with the received data.
+         * @param length            The length of the buffer.
+         * @param o_timestamp       Filled with the receive time (`CLOCK_REALTIME`); zero if no timestamp was attached.
+         * @param o_senderAddress   Filled with the sender's address.
+         * @param flags             Receive flags.
+         * @return On success, the amount of bytes received; on error `-errno`.
+         */
+        inline ssize_t ReceiveTimestamped(void *o_buffer, size_t length, struct timespec &o_timestamp,
+                                          Address<D> &o_senderAddress, EReceiveFlags flags = EReceiveFlags::None)
+        {
+            return ReceiveTimestamped(o_buffer, length, o_timestamp, &o_senderAddress, flags);
+        }
+
+        /**
+         * Reads pending transmit timestamps from the socket's error queue, without blocking.
+         * Requires `SocketOption::Timestamping` with one of the transmit flags and `ETimestampingFlags::Software`
+         * (`ETimestampingFlags::Id | ETimestampingFlags::TimestampOnly` are recommended).
+         * The socket reports `EPOLLERR` while timestamps are pending.
+         *
+         * @note Reading stops at a zero-copy completion, which is kept for `ReadZeroCopyCompletions`
+         *          (or `ReadErrorQueue`); a queued error is returned as `-errno`.
+         *
+         * @tparam N    The maximal amount of timestamps to read.
+         *
+         * @param o_timestamps  Filled with the timestamps.
+         * @return On success, the amount of timestamps read (`0` if none are pending); on error `-errno`.
+         */
+        template <size_t N>
+        inline int ReadTransmitTimestamps(TransmitTimestamp (&o_timestamps)[N])
+        {
+            static_assert(D != ESocketDomain::Unix, "Transmit timestamps require an IP or a packet socket.");
+            return ReadErrorQueueOf<EErrorQueueMessageType::TransmitTimestamp>(o_timestamps, &ErrorQueueMessage::timestamp);
+        }
+
+        /**
+         * Receives up to `N` datagrams in a single call (`recvmmsg`), each into its own buffer.
+         *
+         * @tparam N    The maximal amount of datagrams.
+         *
+         * @param buffers   The buffers to fill, one per datagram.
+         * @param o_lengths Filled with the length of each received datagram.
+         * @param flags     Receive flags. `EReceiveFlags::WaitForOne` stops waiting after the first datagram.
+         * @return On success, the amount of datagrams received; on error `-errno`.
+         */
+        template <size_t N>
+        int ReceiveBatch(membuf (&buffers)[N], size_t (&o_lengths)[N], EReceiveFlags flags = EReceiveFlags::None)
+        {
+            return ReceiveBatch<N>(buffers, o_lengths, nullptr, flags);
+        }
+
+        /**
+         * Receives up to `N` datagrams in a single call (`recvmmsg`), along with their senders' addresses.
+         *
+         * @tparam N    The maximal amount of datagrams.
+         *
+         * @param buffers   The buffers to fill, one per datagram.
+         * @param o_lengths Filled with the length of each received datagram.
+         * @param o_senders Filled with the sender of each received datagram (when possible).
+         * @param flags     Receive flags. `EReceiveFlags::WaitForOne` stops waiting after the first datagram.
+         * @return On success, the amount of datagrams received; on error `-errno`.
+         */
+        template <size_t N>
+        int ReceiveBatch(membuf (&buffers)[N], size_t (&o_lengths)[N], Address<D> (&o_senders)[N],
+                         EReceiveFlags flags = EReceiveFlags::None)
+        {
+            return ReceiveBatch<N>(buffers, o_lengths, &o_senders, flags);
+        }
+
+        /**
+         * Sends up to `count` datagrams in a single call (`sendmmsg`) through a connected socket.
+         *
+         * @tparam N    The size of the batch.
+         *
+         * @param buffers   The datagrams to send.
+         * @param flags     Send flags.
+         * @param count     The amount of datagrams to send, from the start of `buffers`. Clamped to `N`.
+         * @return On success, the amount of datagrams sent (possibly less than `count`); on error `-errno`.
+         */
+        template <size_t N>
+        int SendBatch(const const_membuf (&buffers)[N], ESendFlags flags = ESendFlags::None, size_t count = N)
+        {
+            return SendBatch<N>(buffers, nullptr, flags, count);
+        }
+
+        /**
+         * Sends up to `count` datagrams in a single call (`sendmmsg`), each to its own destination.
+         *
+         * @tparam N    The size of the batch.
+         *
+         * @param buffers       The datagrams to send.
+         * @param destinations  The destination of each datagram.
+         * @param flags         Send flags.
+         * @param count         The amount of datagrams to send, from the start of `buffers`. Clamped to `N`.
+         * @return On success, the amount of datagrams sent (possibly less than `count`); on error `-errno`.
+         */
+        template <size_t N>
+        int SendBatch(const const_membuf (&buffers)[N], const Address<D> (&destinations)[N],
+                      ESendFlags flags = ESendFlags::None, size_t count = N)
+        {
+            return SendBatch<N>(buffers, &destinations, flags, count);
+        }
+
+    public:
+        /**
+         * Creates a pair of connected sockets.
+         *
+         * @param type          The domain of the created sockets.
+         * @param o_socket1     A reference to a non-opened socket object.
+         * @param o_socket2     A reference to a non-opened socket object.
+         * @return `0` on success; `-errno` on error.
+         */
+        static int Pair(ESocketType type, Socket &o_socket1, Socket &o_socket2)
+        {
+            int fds[2] = {-EBADFD, -EBADFD};
+            int sockErr = 0;
+
+            if (o_socket1.IsOpen() || o_socket2.IsOpen())
+            {
+                return -EBUSY;
+            }
+
+            sockErr = socketpair((int)D, (int)type, 0, fds);
+            if (sockErr != 0)
+            {
+                return -errno;
+            }
+
+            o_socket1.m_descriptor = fds[0];
+            o_socket2.m_descriptor = fds[1];
+
+            return 0;
+        }
+
+    private:
+        ssize_t SendMessage(const struct iovec *vectors, size_t count, const Address<D> *destination,
+                            const void *control, size_t controlLength, ESendFlags flags)
+        {
+            struct msghdr message;
+            ssize_t bytesSent;
+
+            memset(&message, 0, sizeof(message));
+
+            message.msg_iov = const_cast<struct iovec *>(vectors);
+            message.msg_iovlen = count;
+            message.msg_control = const_cast<void *>(control);
+            message.msg_controllen = controlLength;
+
+            if (destination != nullptr)
+            {
+                message.msg_name = const_cast<sockaddr *>(destination->GetBase());
+                message.msg_namelen = destination->GetLength();
+            }
+
+            bytesSent = sendmsg(m_descriptor, &message, (int)flags);
+            if (bytesSent < 0)
+            {
+                return -errno;
+            }
+
+            return bytesSent;
+        }
+
+        /**
+         * @param io_controlLength  The capacity of `o_control` on input; the length of the received control messages on output.
+         */
+        ssize_t ReceiveMessage(struct iovec *vectors, size_t count, Address<D> *o_senderAddress,
+                               void *o_control, size_t &io_controlLength, int flags)
+        {
+            struct msghdr message;
+            ssize_t bytesReceived;
+
+            memset(&message, 0, sizeof(message));
+
+            message.msg_iov = vectors;
+            message.msg_iovlen = count;
+            message.msg_control = o_control;
+            message.msg_controllen = io_controlLength;
+
+            if (o_senderAddress != nullptr)
+            {
+                message.msg_name = o_senderAddress->GetBase();
+                message.msg_namelen = Address<D>::s_MaxSize;
+            }
+
+            bytesReceived = recvmsg(m_descriptor, &message, flags);
+            if (bytesReceived < 0)
+            {
+                io_controlLength = 0;
+                return -errno;
+            }
+
+            if (o_senderAddress != nullptr)
+            {
+                o_senderAddress->SetLength(message.msg_namelen);
+            }
+
+            io_controlLength = message.msg_controllen;
+            return bytesReceived;
+        }
+
+        template <size_t C>
+        inline ssize_t SendWithControl(const void *buffer, size_t length, const Address<D> *destination,
+                                       const ControlBuffer<C> &control, ESendFlags flags)
+        {
+            struct iovec vector;
+
+            vector.iov_base = const_cast<void *>(buffer);
+            vector.iov_len = length;
+
+            return SendMessage(&vector, 1, destination, control.GetData(), control.GetLength(), flags);
+        }
+
+        template <size_t C>
+        inline ssize_t ReceiveWithControl(void *o_buffer, size_t length, Address<D> *o_senderAddress,
+                                          ControlBuffer<C> &o_control, int flags)
+        {
+            struct iovec vector;
+            size_t controlLength = o_control.Capacity();
+
+            vector.iov_base = o_buffer;
+            vector.iov_len = length;
+
+            ssize_t bytesReceived = ReceiveMessage(&vector, 1, o_senderAddress, o_control.GetData(), controlLength, flags);
+            o_control.SetLength(controlLength);
+
+            return bytesReceived;
+        }
+
+        int Accept(Socket &o_client, Address<D> *o_clientAddress, EAcceptFlags flags)
+        {
+            int descriptor;
+            socklen_t addressLength = Address<D>::s_MaxSize;
+
+            if (o_client.IsOpen())
+            {
+                return -EBUSY;
+            }
+
+            if (o_clientAddress != nullptr)
+            {
+                descriptor = accept4(m_descriptor, o_clientAddress->GetBase(), &addressLength, (int)flags);
+            }
+            else
+            {
+                descriptor = accept4(m_descriptor, nullptr, nullptr, (int)flags);
+            }
+
+            if (descriptor < 0)
+            {
+                return -errno;
+            }
+
+            if (o_clientAddress != nullptr)
+            {
+                o_clientAddress->SetLength(addressLength);
+            }
+
+            o_client.m_descriptor = descriptor;
+            o_client.m_zeroCopySequence = 0;
+            o_client.m_isZeroCopyEnabled = false;
+            o_client.m_hasPendingErrorMessage = false;
+
+            return 0;
+        }
+
+        ssize_t SendSegmented(const void *buffer, size_t length, uint16_t segmentSize,
+                              const Address<D> *destination, ESendFlags flags)
+        {
+            static_assert((D == ESocketDomain::IPv4) || (D == ESocketDomain::IPv6), "UDP segmentation requires an IP socket.");
+            ControlBuffer<ControlSpace<uint16_t>::value> control;
+
+            if (buffer == nullptr)
+            {
+                return -EINVAL;
+            }
+
+            control.Add(SOL_UDP, UDP_SEGMENT, segmentSize);
+
+            return SendWithControl(buffer, length, destination, control, flags);
+        }
+
+        ssize_t ReceiveCoalesced(void *o_buffer, size_t length, uint16_t &o_segmentSize,
+                                 Address<D> *o_senderAddress, EReceiveFlags flags)
+        {
+            static_assert((D == ESocketDomain::IPv4) || (D == ESocketDomain::IPv6), "UDP coalescing requires an IP socket.");
+            ControlBuffer<ControlSpace<int>::value> control;
+            ssize_t bytesReceived;
+            int segmentSize;
+
+            if (o_buffer == nullptr)
+            {
+                return -EINVAL;
+            }
+
+            bytesReceived = ReceiveWithControl(o_buffer, length, o_senderAddress, control, (int)flags);
+            if (bytesReceived < 0)
+            {
+                return bytesReceived;
+            }
+
+            o_segmentSize = (uint16_t)bytesReceived;
+
+            for (ControlMessage message : control.GetMessages())
+            {
+                if (message.Is(SOL_UDP, UDP_GRO) && message.Get(segmentSize))
+                {
+                    o_segmentSize = (uint16_t)segmentSize;
+                }
+            }
+
+            return bytesReceived;
+        }
+
+        /**
+         * Reads a single message from the error queue, starting with a kept one.
+         * Messages without an extended error, and timestamps without a time, are skipped.
+         *
+         * @return `0` on success; `-EAGAIN` if the queue is empty; `-errno` on error.
+         */
+        int ReadErrorMessage(ErrorQueueMessage &o_message)
+        {
+            struct scm_timestamping timestamps;
+            struct sock_extended_err error;
+
+            if (m_hasPendingErrorMessage)
+            {
+                o_message = m_pendingErrorMessage;
+                m_hasPendingErrorMessage = false;
+                return 0;
+            }
+
+            while (true)
+            {
+                ControlBuffer<ControlSpace<struct scm_timestamping>::value +
+                              ControlSpace<struct sock_extended_err>::value + sizeof(struct sockaddr_in6)> control;
+                bool hasTime = false;
+                bool hasError = false;
+
+                ssize_t res = ReceiveWithControl(nullptr, 0, nullptr, control, MSG_ERRQUEUE | MSG_DONTWAIT);
+                if (res < 0)
+                {
+                    return (int)res;
+                }
+
+                for (ControlMessage message : control.GetMessages())
+                {
+                    if (message.Is(SOL_SOCKET, SCM_TIMESTAMPING) && message.Get(timestamps))
+                    {
+                        hasTime = true;
+                    }
+                    else if ((message.Is(SOL_IP, IP_RECVERR) || message.Is(SOL_IPV6, IPV6_RECVERR) ||
+                              message.Is(SOL_PACKET, PACKET_TX_TIMESTAMP)) && message.Get(error))
+                    {
+                        hasError = true;
+                    }
+                }
+
+                if (!hasError)
+                {
+                    continue;
+                }
+
+                if ((error.ee_origin == SO_EE_ORIGIN_ZEROCOPY) && (error.ee_errno == 0))
+                {
+                    o_message.type = EErrorQueueMessageType::ZeroCopyCompletion;
+                    o_message.completion.first = error.ee_info;
+                    o_message.completion.last = error.ee_data;
+                    o_message.completion.isCopied = ((error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0);
+                }
+                else if ((error.ee_origin == SO_EE_ORIGIN_TIMESTAMPING) && (error.ee_errno == ENOMSG))
+                {
+                    if (!hasTime)
+                    {
+                        continue;
+                    }
+
+                    // The software timestamp is the first; the others are hardware ones.
+                    o_message.type = EErrorQueueMessageType::TransmitTimestamp;
+                    o_message.timestamp.id = error.ee_data;
+                    o_message.timestamp.type = (ETimestampType)error.ee_info;
+                    o_message.timestamp.time = timestamps.ts[0];
+                }
+                else
+                {
+                    o_message.type = EErrorQueueMessageType::Error;
+                    o_message.error = error;
+                }
+
+                return 0;
+            }
+        }
+
+        /**
+         * Reads the messages of a single kind from the error queue.
+         * A message of another kind stops the read, and is kept for the next reader.
+         */
+        template <EErrorQueueMessageType Type, typename T, size_t N>
+        int ReadErrorQueueOf(T (&o_items)[N], T ErrorQueueMessage::*member)
+        {
+            ErrorQueueMessage message;
+            size_t count = 0;
+
+            while (count < N)
+            {
+                int err = ReadErrorMessage(message);
+                if (err == -EAGAIN)
+                {
+                    break;
+                }
+                else if (err < 0)
+                {
+                    return (count > 0) ? (int)count : err;
+                }
+                else if (message.type == Type)
+                {
+                    o_items[count++] = message.*member;
+                    continue;
+                }
+
+                // Errors are reported right away, unless items were already read.
+                if ((message.type == EErrorQueueMessageType::Error) && (count == 0))
+                {
+                    return (message.error.ee_errno != 0) ? -(int)message.error.ee_errno : -EIO;
+                }
+
+                m_pendingErrorMessage = message;
+                m_hasPendingErrorMessage = true;
+                break;
+            }
+
+            return (int)count;
+        }
+
+        ssize_t ReceiveTimestamped(void *o_buffer, size_t length, struct timespec &o_timestamp,
+                                   Address<D> *o_senderAddress, EReceiveFlags flags)
+        {
+            ControlBuffer<ControlSpace<struct scm_timestamping>::value> control;
+            struct scm_timestamping timestamps;
+            ssize_t bytesReceived;
+
+            if (o_buffer == nullptr)
+            {
+                return -EINVAL;
+            }
+
+            memset(&o_timestamp, 0, sizeof(o_timestamp));
+
+            bytesReceived = ReceiveWithControl(o_buffer, length, o_senderAddress, control, (int)flags);
+            if (bytesReceived < 0)
+            {
+                return bytesReceived;
+            }
+
+            for (ControlMessage message : control.GetMessages())
+            {
+                if (message.Is(SOL_SOCKET, SCM_TIMESTAMPNS))
+                {
+                    message.Get(o_timestamp);
+                }
+                else if (message.Is(SOL_SOCKET, SCM_TIMESTAMPING) && message.Get(timestamps))
+                {
+                    // The software timestamp is the first; the others are hardware ones.
+                    o_timestamp = timestamps.ts[0];
+                }
+            }
+
+            return bytesReceived;
+        }
+
+        template <size_t N>
+        int ReceiveBatch(membuf (&buffers)[N], size_t (&o_lengths)[N], Address<D> (*o_senders)[N], EReceiveFlags flags)
+        {
+            struct mmsghdr messages[N];
+            struct iovec vectors[N];
+            int count;
+
+            memset(messages, 0, sizeof(messages));
+
+            for (size_t index = 0; index < N; index++)
+            {
+                vectors[index].iov_base = buffers[index].buffer;
+                vectors[index].iov_len = buffers[index].length;
+                messages[index].msg_hdr.msg_iov = &vectors[index];
+                messages[index].msg_hdr.msg_iovlen = 1;
+
+                if (o_senders != nullptr)
+                {
+                    messages[index].msg_hdr.msg_name = (*o_senders)[index].GetBase();
+                    messages[index].msg_hdr.msg_namelen = Address<D>::s_MaxSize;
+                }
+            }
+
+            count = recvmmsg(m_descriptor, messages, N, (int)flags, nullptr);
+            if (count < 0)
+            {
+                return -errno;
+            }
+
+            for (int index = 0; index < count; index++)
+            {
+                o_lengths[index] = messages[index].msg_len;
+
+                if (o_senders != nullptr)
+                {
+                    (*o_senders)[index].SetLength(messages[index].msg_hdr.msg_namelen);
+                }
+            }
+
+            return count;
+        }
+
+        template <size_t N>
+        int SendBatch(const const_membuf (&buffers)[N], const Address<D> (*destinations)[N], ESendFlags flags, size_t count)
+        {
+            struct mmsghdr messages[N];
+            struct iovec vectors[N];
+            int sent;
+
+            if (count > N)
+            {
+                count = N;
+            }
+
+            memset(messages, 0, sizeof(messages));
+
+            for (size_t index = 0; index < count; index++)
+            {
+                vectors[index].iov_base = const_cast<void *>(buffers[index].buffer);
+                vectors[index].iov_len = buffers[index].length;
+                messages[index].msg_hdr.msg_iov = &vectors[index];
+                messages[index].msg_hdr.msg_iovlen = 1;
+
+                if (destinations != nullptr)
+                {
+                    messages[index].msg_hdr.msg_name = const_cast<sockaddr *>((*destinations)[index].GetBase());
+                    messages[index].msg_hdr.msg_namelen = (*destinations)[index].GetLength();
+                }
+            }
+
+            sent = sendmmsg(m_descriptor, messages, (unsigned int)count, (int)flags);
+            if (sent < 0)
+            {
+                return -errno;
+            }
+
+            return sent;
+        }
+
+        uint32_t m_zeroCopySequence;
+        bool m_isZeroCopyEnabled;
+
+        /**
+         * A message that was read from the error queue by a reader of another kind, kept for the next reader.
+         */
+        ErrorQueueMessage m_pendingErrorMessage;
+        bool m_hasPendingErrorMessage;
     };
 
 
     using UnixSocket = Socket<ESocketDomain::Unix>;
     using IPv4Socket = Socket<ESocketDomain::IPv4>;
     using IPv6Socket = Socket<ESocketDomain::IPv6>;
+    using PacketSocket = Socket<ESocketDomain::Packet>;
 }
 
 #endif //KRAKEN_SOCKET_H
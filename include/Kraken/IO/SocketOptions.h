@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file SocketOptions.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#ifndef KRAKEN_SOCKETOPTIONS_H
+#define KRAKEN_SOCKETOPTIONS_H
+
+#include <Kraken/IO/Address.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
+#include <sys/time.h>
+#include <linux/filter.h>
+#include <linux/net_tstamp.h>
+
+namespace Kraken
+{
+    /**
+     * The sets of socket domains an option applies to.
+     */
+    namespace SocketOptionDomains
+    {
+        constexpr unsigned Unix = 1 << 0;
+        constexpr unsigned IPv4 = 1 << 1;
+        constexpr unsigned IPv6 = 1 << 2;
+        constexpr unsigned Packet = 1 << 3;
+
+        constexpr unsigned IP = IPv4 | IPv6;
+        constexpr unsigned All = Unix | IP | Packet;
+
+        /**
+         * @return The bit of the given domain.
+         */
+        constexpr unsigned Of(ESocketDomain domain)
+        {
+            return (domain == ESocketDomain::Unix) ? Unix :
+                   (domain == ESocketDomain::IPv4) ? IPv4 :
+                   (domain == ESocketDomain::IPv6) ? IPv6 :
+                   (domain == ESocketDomain::Packet) ? Packet : 0;
+        }
+    }
+
+    /**
+     * Whether an option can be read, written or both.
+     */
+    enum class EOptionAccess
+    {
+        Read = 1 << 0,
+        Write = 1 << 1,
+        ReadWrite = Read | Write,
+    };
+
+    /**
+     * The set of flags for `SocketOption::Timestamping`.
+     */
+    enum class ETimestampingFlags
+    {
+        None = 0,
+
+        /**
+         * Timestamp received packets when they enter the kernel.
+         */
+        ReceiveSoftware = SOF_TIMESTAMPING_RX_SOFTWARE,
+
+        /**
+         * Timestamp sent packets when they are handed to the device.
+         */
+        TransmitSoftware = SOF_TIMESTAMPING_TX_SOFTWARE,
+
+        /**
+         * Timestamp sent packets when they enter the packet scheduler.
+         */
+        TransmitScheduled = SOF_TIMESTAMPING_TX_SCHED,
+
+        /**
+         * Timestamp sent (TCP) data when it is acknowledged by the peer.
+         */
+        TransmitAcknowledged = SOF_TIMESTAMPING_TX_ACK,
+
+        /**
+         * Report software timestamps. Required along with the software generation flags.
+         */
+        Software = SOF_TIMESTAMPING_SOFTWARE,
+
+        /**
+         * Number transmit timestamps by send (or by byte, for TCP), instead of echoing the packet.
+         */
+        Id = SOF_TIMESTAMPING_OPT_ID,
+
+        /**
+         * Report transmit timestamps without a copy of the packet.
+         */
+        TimestampOnly = SOF_TIMESTAMPING_OPT_TSONLY,
+    };
+
+    ENUM_FLAGS(ETimestampingFlags);
+
+    /**
+     * The policy a packet fanout group uses to pick the socket that receives a frame (see `Socket::JoinFanout`).
+     */
+    enum class EPacketFanoutMode
+    {
+        /**
+         * By the flow hash, so all of the frames of a flow reach the same socket.
+         */
+        Hash = PACKET_FANOUT_HASH,
+
+        /**
+         * Round-robin.
+         */
+        LoadBalance = PACKET_FANOUT_LB,
+
+        /**
+         * By the CPU the frame arrived on.
+         */
+        Cpu = PACKET_FANOUT_CPU,
+
+        /**
+         * Fill a socket until it's backlogged, then move on to the next one.
+         */
+        Rollover = PACKET_FANOUT_ROLLOVER,
+        Random = PACKET_FANOUT_RND,
+
+        /**
+         * By the receive queue of the device.
+         */
+        QueueMapping = PACKET_FANOUT_QM,
+    };
+
+    /**
+     * The set of flags for `Socket::JoinFanout`.
+     */
+    enum class EPacketFanoutFlags
+    {
+        None = 0,
+
+        /**
+         * Move frames to another socket when the chosen one is backlogged.
+         */
+        Rollover = PACKET_FANOUT_FLAG_ROLLOVER,
+
+        /**
+         * Reassemble IP fragments before picking a socket, so they hash to the same one.
+         */
+        Defragment = PACKET_FANOUT_FLAG_DEFRAG,
+    };
+
+    ENUM_FLAGS(EPacketFanoutFlags);
+
+    /**
+     * Describes a socket option, for `Socket::SetOption` and `Socket::GetOption`.
+     *
+     * @tparam Level    The protocol level of the option (`SOL_SOCKET`, `IPPROTO_TCP`, ...).
+     * @tparam Name     The name of the option.
+     * @tparam T        The type of the option's value, as seen by the user.
+     * @tparam Domains  The set of domains the option applies to (see `SocketOptionDomains`).
+     * @tparam Access   Whether the option can be read, written or both.
+     * @tparam Native   The type of the option's value, as the kernel expects it.
+     */
+    template <int Level, int Name, typename T, unsigned Domains,
+              EOptionAccess Access = EOptionAccess::ReadWrite, typename Native = T>
+    struct SocketOptionDescriptor
+    {
+        typedef T ValueType;
+        typedef Native NativeType;
+
+        static constexpr int s_Level = Level;
+        static constexpr int s_Name = Name;
+
+        /**
+         * @return `true` if the option applies to sockets of the given domain.
+         */
+        static constexpr bool IsApplicable(ESocketDomain domain)
+        {
+            return (Domains & SocketOptionDomains::Of(domain)) != 0;
+        }
+
+        static constexpr bool IsReadable()
+        {
+            return ((int)Access & (int)EOptionAccess::Read) != 0;
+        }
+
+        static constexpr bool IsWritable()
+        {
+            return ((int)Access & (int)EOptionAccess::Write) != 0;
+        }
+    };
+
+    /**
+     * An on/off option, passed to the kernel as an `int`.
+     */
+    template <int Level, int Name, unsigned Domains>
+    using BooleanSocketOption = SocketOptionDescriptor<Level, Name, bool, Domains, EOptionAccess::ReadWrite, int>;
+
+    /**
+     * The table of supported socket options.
+     */
+    namespace SocketOption
+    {
+        // SOL_SOCKET
+        using SendBufferSize = SocketOptionDescriptor<SOL_SOCKET, SO_SNDBUF, int, SocketOptionDomains::All>;
+        using ReceiveBufferSize = SocketOptionDescriptor<SOL_SOCKET, SO_RCVBUF, int, SocketOptionDomains::All>;
+        using SendTimeout = SocketOptionDescriptor<SOL_SOCKET, SO_SNDTIMEO, struct timeval, SocketOptionDomains::All>;
+        using ReceiveTimeout = SocketOptionDescriptor<SOL_SOCKET, SO_RCVTIMEO, struct timeval, SocketOptionDomains::All>;
+        using ReceiveLowWatermark = SocketOptionDescriptor<SOL_SOCKET, SO_RCVLOWAT, int, SocketOptionDomains::All>;
+        using Priority = SocketOptionDescriptor<SOL_SOCKET, SO_PRIORITY, int, SocketOptionDomains::All>;
+        using Linger = SocketOptionDescriptor<SOL_SOCKET, SO_LINGER, struct linger, SocketOptionDomains::All>;
+        using Error = SocketOptionDescriptor<SOL_SOCKET, SO_ERROR, int, SocketOptionDomains::All, EOptionAccess::Read>;
+        using PassCredentials = BooleanSocketOption<SOL_SOCKET, SO_PASSCRED, SocketOptionDomains::Unix>;
+        using ReuseAddress = BooleanSocketOption<SOL_SOCKET, SO_REUSEADDR, SocketOptionDomains::IP>;
+        using ReusePort = BooleanSocketOption<SOL_SOCKET, SO_REUSEPORT, SocketOptionDomains::IP>;
+        using KeepAlive = BooleanSocketOption<SOL_SOCKET, SO_KEEPALIVE, SocketOptionDomains::IP>;
+        using IncomingCpu = SocketOptionDescriptor<SOL_SOCKET, SO_INCOMING_CPU, int, SocketOptionDomains::IP>;
+        using BusyPoll = SocketOptionDescriptor<SOL_SOCKET, SO_BUSY_POLL, int, SocketOptionDomains::IP>;
+        using ZeroCopy = BooleanSocketOption<SOL_SOCKET, SO_ZEROCOPY, SocketOptionDomains::IP>;
+        using TimestampNanoseconds = BooleanSocketOption<SOL_SOCKET, SO_TIMESTAMPNS, SocketOptionDomains::All>;
+        using Timestamping = SocketOptionDescriptor<SOL_SOCKET, SO_TIMESTAMPING, ETimestampingFlags,
+                                                    SocketOptionDomains::All, EOptionAccess::ReadWrite, int>;
+        using AttachReusePortFilter = SocketOptionDescriptor<SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, struct sock_fprog,
+                                                             SocketOptionDomains::IP, EOptionAccess::Write>;
+
+        // IPPROTO_TCP
+        using NoDelay = BooleanSocketOption<IPPROTO_TCP, TCP_NODELAY, SocketOptionDomains::IP>;
+        using Cork = BooleanSocketOption<IPPROTO_TCP, TCP_CORK, SocketOptionDomains::IP>;
+        using QuickAck = BooleanSocketOption<IPPROTO_TCP, TCP_QUICKACK, SocketOptionDomains::IP>;
+        using NotSentLowWatermark = SocketOptionDescriptor<IPPROTO_TCP, TCP_NOTSENT_LOWAT, unsigned int, SocketOptionDomains::IP>;
+        using UserTimeout = SocketOptionDescriptor<IPPROTO_TCP, TCP_USER_TIMEOUT, unsigned int, SocketOptionDomains::IP>;
+
+        // SOL_UDP
+        using UdpSegment = SocketOptionDescriptor<SOL_UDP, UDP_SEGMENT, int, SocketOptionDomains::IP>;
+        using UdpGro = BooleanSocketOption<SOL_UDP, UDP_GRO, SocketOptionDomains::IP>;
+
+        // IPPROTO_IP
+        using TypeOfService = SocketOptionDescriptor<IPPROTO_IP, IP_TOS, int, SocketOptionDomains::IPv4>;
+        using TimeToLive = SocketOptionDescriptor<IPPROTO_IP, IP_TTL, int, SocketOptionDomains::IPv4>;
+        using ReceiveErrors = BooleanSocketOption<IPPROTO_IP, IP_RECVERR, SocketOptionDomains::IPv4>;
+        using ReceivePacketInfo = BooleanSocketOption<IPPROTO_IP, IP_PKTINFO, SocketOptionDomains::IPv4>;
+
+        // SOL_PACKET
+        using PacketVersion = SocketOptionDescriptor<SOL_PACKET, PACKET_VERSION, int, SocketOptionDomains::Packet>;
+        using PacketReceiveRing = SocketOptionDescriptor<SOL_PACKET, PACKET_RX_RING, struct tpacket_req3,
+                                                         SocketOptionDomains::Packet, EOptionAccess::Write>;
+        using PacketTransmitRing = SocketOptionDescriptor<SOL_PACKET, PACKET_TX_RING, struct tpacket_req3,
+                                                          SocketOptionDomains::Packet, EOptionAccess::Write>;
+        using PacketFanout = SocketOptionDescriptor<SOL_PACKET, PACKET_FANOUT, int, SocketOptionDomains::Packet>;
+        using PacketStatistics = SocketOptionDescriptor<SOL_PACKET, PACKET_STATISTICS, struct tpacket_stats_v3,
+                                                        SocketOptionDomains::Packet, EOptionAccess::Read>;
+        using PacketAddMembership = SocketOptionDescriptor<SOL_PACKET, PACKET_ADD_MEMBERSHIP, struct packet_mreq,
+                                                           SocketOptionDomains::Packet, EOptionAccess::Write>;
+        using PacketQdiscBypass = BooleanSocketOption<SOL_PACKET, PACKET_QDISC_BYPASS, SocketOptionDomains::Packet>;
+        using PacketIgnoreOutgoing = BooleanSocketOption<SOL_PACKET, PACKET_IGNORE_OUTGOING, SocketOptionDomains::Packet>;
+        using PacketLoss = BooleanSocketOption<SOL_PACKET, PACKET_LOSS, SocketOptionDomains::Packet>;
+
+        // IPPROTO_IPV6
+        using TrafficClass = SocketOptionDescriptor<IPPROTO_IPV6, IPV6_TCLASS, int, SocketOptionDomains::IPv6>;
+        using HopLimit = SocketOptionDescriptor<IPPROTO_IPV6, IPV6_UNICAST_HOPS, int, SocketOptionDomains::IPv6>;
+        using V6Only = BooleanSocketOption<IPPROTO_IPV6, IPV6_V6ONLY, SocketOptionDomains::IPv6>;
+    }
+}
+
+#endif //KRAKEN_SOCKETOPTIONS_H
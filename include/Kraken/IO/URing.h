@@ -0,0 +1,507 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file URing.h
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#ifndef KRAKEN_URING_H
+#define KRAKEN_URING_H
+
+#include <Kraken/IO/IEPollable.h>
+#include <Kraken/IO/Socket.h>
+#include <errno.h>
+#include <stdint.h>
+#include <linux/io_uring.h>
+
+namespace Kraken
+{
+    /**
+     * The set of io_uring setup flags.
+     */
+    enum class EURingFlags
+    {
+        None = 0,
+        Clamp = IORING_SETUP_CLAMP,
+        SubmitAll = IORING_SETUP_SUBMIT_ALL,
+        CooperativeTaskRun = IORING_SETUP_COOP_TASKRUN,
+        SingleIssuer = IORING_SETUP_SINGLE_ISSUER,
+    };
+
+    /**
+     * Per-submission flags.
+     */
+    enum class ESubmitFlags
+    {
+        None = 0,
+
+        /**
+         * The next submission will not start before this one completes successfully.
+         * A failure cancels the rest of the chain with `-ECANCELED`.
+         */
+        Link = IOSQE_IO_LINK,
+
+        /**
+         * Like `Link`, but the chain is not broken by a failure.
+         */
+        HardLink = IOSQE_IO_HARDLINK,
+
+        /**
+         * Do not post a completion if the operation succeeded.
+         */
+        SkipSuccess = IOSQE_CQE_SKIP_SUCCESS,
+    };
+
+    ENUM_FLAGS(EURingFlags);
+    ENUM_FLAGS(ESubmitFlags);
+
+    /**
+     * The kind of operation a completion belongs to.
+     *
+     * The operation is encoded in the low bits of the completion's user data,
+     * next to the address of the socket that was used as the tag.
+     */
+    enum class EURingOperation
+    {
+        Accept = 0,
+        Receive = 1,
+        Send = 2,
+        Cancel = 3,
+    };
+
+    /**
+     * A single io_uring completion.
+     */
+    struct URingCompletion
+    {
+        /**
+         * The raw user-data of the completion: A tag pointer or'ed with the operation.
+         */
+        uint64_t userData;
+
+        /**
+         * The result of the operation; `-errno` on error.
+         *
+         * For accept operations this is the new client descriptor,
+         * for receive and send operations it is the amount of bytes transferred.
+         */
+        int32_t result;
+
+        /**
+         * Completion flags (IORING_CQE_F_*).
+         */
+        uint32_t flags;
+
+        /**
+         * @return The operation that generated this completion.
+         */
+        inline EURingOperation GetOperation() const
+        {
+            return (EURingOperation)(userData & s_OperationMask);
+        }
+
+        /**
+         * @return The tag that was given at submission time.
+         */
+        inline void *GetTag() const
+        {
+            return (void *)(uintptr_t)(userData & ~s_OperationMask);
+        }
+
+        /**
+         * @tparam D    The domain of the socket the operation was submitted on.
+         * @return A reference to the socket the operation was submitted on.
+         */
+        template <ESocketDomain D>
+        inline Socket<D> &GetSocket() const
+        {
+            return *static_cast<Socket<D> *>(GetTag());
+        }
+
+        /**
+         * @return `true` if the submission is multishot and is still armed; `false` if it will produce no more completions.
+         */
+        inline bool HasMore() const
+        {
+            return (flags & IORING_CQE_F_MORE) != 0;
+        }
+
+        /**
+         * @return `true` if the data was received into a buffer from a buffer ring.
+         */
+        inline bool HasBuffer() const
+        {
+            return (flags & IORING_CQE_F_BUFFER) != 0;
+        }
+
+        /**
+         * @return The ID of the selected buffer. Only meaningful when `HasBuffer` returns `true`.
+         */
+        inline uint16_t GetBufferId() const
+        {
+            return (uint16_t)(flags >> IORING_CQE_BUFFER_SHIFT);
+        }
+
+        /**
+         * The bits of the user data used to hold the operation.
+         */
+        static constexpr uint64_t s_OperationMask = 0x7;
+    };
+
+    class URing;
+
+    /**
+     * A ring of kernel-provided receive buffers.
+     *
+     * The caller supplies the backing storage, which is divided into `bufferCount` equally sized buffers.
+     * The kernel picks a free buffer for each received message, and the buffer belongs to the
+     * user until it is handed back with `Recycle`.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class URingBufferRing
+    {
+    public:
+        URingBufferRing() :
+                m_owner(nullptr),
+                m_nextBufferRing(nullptr),
+                m_ring(nullptr),
+                m_storage(nullptr),
+                m_bufferSize(0),
+                m_bufferCount(0),
+                m_groupId(0),
+                m_tail(0)
+        {}
+
+        ~URingBufferRing()
+        {
+            if (IsOpen())
+            {
+                Close();
+            }
+        }
+
+        /**
+         * Registers a new buffer ring with the given io_uring instance.
+         *
+         * @note Fails with `-EBUSY` if this object is already registered.
+         *
+         * @param ring          An open io_uring instance.
+         * @param groupId       The buffer group ID to register. Receive operations refer to the ring using this ID.
+         * @param storage       The memory to divide into buffers. Must outlive the registration.
+         * @param bufferCount   The amount of buffers. Must be a power of two, no larger than 32768.
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(URing &ring, uint16_t groupId, membuf storage, uint16_t bufferCount);
+
+        /**
+         * Returns the received data of a completion.
+         *
+         * @param completion    A successful receive completion that selected a buffer.
+         * @return A view of the received data inside the ring's storage.
+         */
+        membuf GetBuffer(const URingCompletion &completion) const;
+
+        /**
+         * Hands a buffer back to the kernel.
+         *
+         * @param bufferId  The ID of the buffer, as returned by `URingCompletion::GetBufferId`.
+         */
+        void Recycle(uint16_t bufferId);
+
+        /**
+         * Hands the buffer of the given completion back to the kernel.
+         *
+         * @param completion    A completion that selected a buffer.
+         */
+        inline void Recycle(const URingCompletion &completion)
+        {
+            Recycle(completion.GetBufferId());
+        }
+
+        /**
+         * @return The buffer group ID of this ring.
+         */
+        inline uint16_t GetGroupId() const
+        {
+            return m_groupId;
+        }
+
+        /**
+         * @return `true` if the ring is registered.
+         */
+        inline bool IsOpen() const
+        {
+            return (m_ring != nullptr);
+        }
+
+        /**
+         * Unregisters the ring and releases its memory.
+         * If the io_uring instance was closed first, the kernel already dropped the registration.
+         */
+        void Close();
+
+    private:
+        friend class URing;
+
+        URingBufferRing(const URingBufferRing &) = delete;
+
+        void Provide(uint16_t bufferId);
+
+        /**
+         * The ring's tail overlays the reserved field of the first buffer.
+         *
+         * @note `io_uring_buf_ring` is not used directly since its flexible-array trick
+         *          places the buffers at a different offset when compiled as C++.
+         */
+        inline uint16_t *GetTailPointer()
+        {
+            return &m_ring[0].resv;
+        }
+
+        /**
+         * The io_uring instance the ring is registered with; `nullptr` once that instance is closed.
+         */
+        URing *m_owner;
+
+        /**
+         * The next buffer ring registered with the same io_uring instance.
+         */
+        URingBufferRing *m_nextBufferRing;
+
+        io_uring_buf *m_ring;
+        uint8_t *m_storage;
+        size_t m_bufferSize;
+        uint16_t m_bufferCount;
+        uint16_t m_groupId;
+        uint16_t m_tail;
+    };
+
+    /**
+     * An io_uring wrapper, geared towards socket IO.
+     *
+     * Submissions are queued in user-space and handed to the kernel in a single syscall,
+     * together with the wait for completions, by `Wait`.
+     * Each socket submission is tagged with the address of its socket, which is handed back in the completion.
+     *
+     * @author  Gilad "Salmon" Naaman
+     * @since   18/10/2026
+     */
+    class URing : public IEPollable
+    {
+    public:
+        URing() :
+                m_descriptor(-EBADFD),
+                m_submissionRing(nullptr),
+                m_submissionRingSize(0),
+                m_completionRing(nullptr),
+                m_completionRingSize(0),
+                m_submissionEntries(nullptr),
+                m_submissionEntriesSize(0),
+                m_submissionTail(0),
+                m_submittedTail(0),
+                m_bufferRings(nullptr)
+        {}
+
+        virtual ~URing()
+        {
+            if (IsOpen())
+            {
+                Close();
+            }
+        }
+
+        /**
+         * Creates a new io_uring instance.
+         *
+         * @note Will fail with `-EBUSY` if the object is already open.
+         *
+         * @param entries   The requested amount of submission queue entries.
+         * @param flags     Setup flags.
+         * @return `0` on success; `-errno` on error.
+         */
+        int Open(unsigned int entries, EURingFlags flags = EURingFlags::None);
+
+        /**
+         * Queues a multishot accept on a listening socket.
+         * Every accepted connection generates a completion whose result is the client's descriptor.
+         *
+         * @param listener  A listening socket. Used as the completion tag.
+         * @param flags     Submission flags.
+         * @return `0` on success; `-errno` on error.
+         */
+        template <ESocketDomain D>
+        inline int Accept(Socket<D> &listener, ESubmitFlags flags = ESubmitFlags::None)
+        {
+            return PrepareAccept(listener.GetFileDescriptor(), &listener, flags);
+        }
+
+        /**
+         * Queues a multishot receive into a buffer ring.
+         * Every received message generates a completion; use `URingBufferRing::GetBuffer` to access its data.
+         *
+         * @note The receive stops (the completion lacks `HasMore`) when the buffer ring runs out of buffers.
+         *
+         * @param socket        The socket to receive from. Used as the completion tag.
+         * @param buffers       The buffer ring to select buffers from.
+         * @param receiveFlags  Receive flags.
+         * @param flags         Submission flags.
+         * @return `0` on success; `-errno` on error.
+         */
+        template <ESocketDomain D>
+        inline int Receive(Socket<D> &socket,
+                           const URingBufferRing &buffers,
+                           EReceiveFlags receiveFlags = EReceiveFlags::None,
+                           ESubmitFlags flags = ESubmitFlags::None)
+        {
+            return PrepareReceive(socket.GetFileDescriptor(), &socket, buffers.GetGroupId(), (int)receiveFlags, flags);
+        }
+
+        /**
+         * Queues a send.
+         * Chain several sends with `ESubmitFlags::Link` to have them executed in order.
+         *
+         * @note The buffer must stay valid until the send completes.
+         *
+         * @param socket    The socket to send through. Used as the completion tag.
+         * @param mem       The buffer to send.
+         * @param sendFlags Send flags.
+         * @param flags     Submission flags.
+         * @return `0` on success; `-errno` on error.
+         */
+        template <ESocketDomain D>
+        inline int Send(Socket<D> &socket,
+                        const_membuf mem,
+                        ESendFlags sendFlags = ESendFlags::None,
+                        ESubmitFlags flags = ESubmitFlags::None)
+        {
+            return PrepareSend(socket.GetFileDescriptor(), &socket, mem, (int)sendFlags, flags);
+        }
+
+        /**
+         * Queues a cancellation of every pending operation on a socket.
+         *
+         * @param socket    The socket whose operations should be cancelled. Used as the completion tag.
+         * @return `0` on success; `-errno` on error.
+         */
+        template <ESocketDomain D>
+        inline int Cancel(Socket<D> &socket)
+        {
+            return PrepareCancel(socket.GetFileDescriptor(), &socket);
+        }
+
+        /**
+         * Hands all of the queued submissions to the kernel without waiting.
+         *
+         * @return The number of submitted entries on success; `-errno` on error.
+         */
+        int Submit();
+
+        /**
+         * Submits the queued entries and reaps completions.
+         *
+         * @tparam N    The maximum amount of completions to reap.
+         *
+         * @param o_completions     Will be filled with the reaped completions.
+         * @param minCompletions    The amount of completions to wait for. `0` for a non-blocking operation.
+         * @return The number of reaped completions on success; `-errno` on error.
+         */
+        template <size_t N>
+        inline int Wait(URingCompletion (&o_completions)[N], unsigned int minCompletions = 1)
+        {
+            static_assert(N > 0, "N must be positive.");
+            return Wait(o_completions, N, minCompletions);
+        }
+
+        /**
+         * Indicates whether the object contains a handle that appears to be valid.
+         *
+         * @return `true` if the ring contains a valid descriptor.
+         */
+        inline bool IsOpen() const
+        {
+            return (m_descriptor >= 0);
+        }
+
+        /**
+         * Returns the underlying file-descriptor handle.
+         * The descriptor becomes readable when completions are available.
+         */
+        fd_t GetFileDescriptor() const override final
+        {
+            return m_descriptor;
+        }
+
+        /**
+         * Unmaps the rings and closes the io_uring instance.
+         * Buffer rings registered with the instance are detached from it, and only need to be closed.
+         */
+        void Close();
+
+    private:
+        friend class URingBufferRing;
+
+        URing(const URing &) = delete;
+
+        io_uring_sqe *GetSubmissionEntry();
+        int Enter(unsigned int toSubmit, unsigned int minCompletions);
+        int Wait(URingCompletion *o_completions, size_t count, unsigned int minCompletions);
+
+        int PrepareAccept(fd_t descriptor, void *tag, ESubmitFlags flags);
+        int PrepareReceive(fd_t descriptor, void *tag, uint16_t groupId, int receiveFlags, ESubmitFlags flags);
+        int PrepareSend(fd_t descriptor, void *tag, const_membuf mem, int sendFlags, ESubmitFlags flags);
+        int PrepareCancel(fd_t descriptor, void *tag);
+
+        fd_t m_descriptor;
+
+        void *m_submissionRing;
+        size_t m_submissionRingSize;
+        void *m_completionRing;
+        size_t m_completionRingSize;
+        io_uring_sqe *m_submissionEntries;
+        size_t m_submissionEntriesSize;
+
+        // Submission queue pointers.
+        uint32_t *m_sqHead;
+        uint32_t *m_sqTail;
+        uint32_t m_sqMask;
+        uint32_t m_sqEntries;
+
+        // Completion queue pointers.
+        uint32_t *m_cqHead;
+        uint32_t *m_cqTail;
+        uint32_t m_cqMask;
+        io_uring_cqe *m_cqes;
+
+        uint32_t m_submissionTail;
+        uint32_t m_submittedTail;
+
+        /**
+         * The buffer rings registered with this instance, linked through `URingBufferRing::m_nextBufferRing`.
+         */
+        URingBufferRing *m_bufferRings;
+    };
+}
+
+#endif //KRAKEN_URING_H
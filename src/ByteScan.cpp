@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file ByteScan.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#include <Kraken/ByteScan.h>
+#include <Kraken/Features.h>
+#include <stdint.h>
+
+#if defined(KRAKEN_OPT_DISABLE_SIMD)
+# define KRAKEN_SCAN_SCALAR
+#elif defined(__AVX2__)
+# define KRAKEN_SCAN_AVX2
+# include <immintrin.h>
+#elif defined(__SSE2__)
+# define KRAKEN_SCAN_SSE2
+# include <emmintrin.h>
+#elif defined(__ARM_NEON)
+# define KRAKEN_SCAN_NEON
+# include <arm_neon.h>
+#else
+# define KRAKEN_SCAN_SCALAR
+#endif
+
+using namespace Kraken;
+
+#if defined(KRAKEN_SCAN_AVX2)
+static const size_t s_VectorSize = 32;
+
+/**
+ * @return A bit per byte of the block at `data`, set where the byte equals `value`.
+ */
+static inline uint32_t MatchByte(const unsigned char *data, __m256i value)
+{
+    __m256i block = _mm256_loadu_si256((const __m256i *)data);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, value));
+}
+
+static inline uint32_t MatchPair(const unsigned char *data, __m256i first, __m256i second)
+{
+    __m256i current = _mm256_loadu_si256((const __m256i *)data);
+    __m256i next = _mm256_loadu_si256((const __m256i *)(data + 1));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(current, first),
+                                                           _mm256_cmpeq_epi8(next, second)));
+}
+
+static inline size_t FirstMatch(uint32_t mask)
+{
+    return (size_t)__builtin_ctz(mask);
+}
+
+# define SPLAT(value) _mm256_set1_epi8((char)(value))
+#elif defined(KRAKEN_SCAN_SSE2)
+static const size_t s_VectorSize = 16;
+
+/**
+ * @return A bit per byte of the block at `data`, set where the byte equals `value`.
+ */
+static inline uint32_t MatchByte(const unsigned char *data, __m128i value)
+{
+    __m128i block = _mm_loadu_si128((const __m128i *)data);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, value));
+}
+
+static inline uint32_t MatchPair(const unsigned char *data, __m128i first, __m128i second)
+{
+    __m128i current = _mm_loadu_si128((const __m128i *)data);
+    __m128i next = _mm_loadu_si128((const __m128i *)(data + 1));
+    return (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(current, first),
+                                                     _mm_cmpeq_epi8(next, second)));
+}
+
+static inline size_t FirstMatch(uint32_t mask)
+{
+    return (size_t)__builtin_ctz(mask);
+}
+
+# define SPLAT(value) _mm_set1_epi8((char)(value))
+#elif defined(KRAKEN_SCAN_NEON)
+static const size_t s_VectorSize = 16;
+
+/**
+ * Narrows a byte-wise comparison result into 4 bits per byte.
+ */
+static inline uint64_t NarrowMask(uint8x16_t matches)
+{
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+/**
+ * @return 4 bits per byte of the block at `data`, set where the byte equals `value`.
+ */
+static inline uint64_t MatchByte(const unsigned char *data, uint8x16_t value)
+{
+    return NarrowMask(vceqq_u8(vld1q_u8(data), value));
+}
+
+static inline uint64_t MatchPair(const unsigned char *data, uint8x16_t first, uint8x16_t second)
+{
+    return NarrowMask(vandq_u8(vceqq_u8(vld1q_u8(data), first), vceqq_u8(vld1q_u8(data + 1), second)));
+}
+
+static inline size_t FirstMatch(uint64_t mask)
+{
+    return (size_t)__builtin_ctzll(mask) >> 2;
+}
+
+# define SPLAT(value) vdupq_n_u8(value)
+#endif
+
+const void *Kraken::FindByte(const void *buffer, size_t length, unsigned char value)
+{
+    const unsigned char *data = (const unsigned char *)buffer;
+
+#if !defined(KRAKEN_SCAN_SCALAR)
+    auto needle = SPLAT(value);
+
+    for (; length >= s_VectorSize; data += s_VectorSize, length -= s_VectorSize)
+    {
+        auto mask = MatchByte(data, needle);
+        if (mask != 0)
+        {
+            return data + FirstMatch(mask);
+        }
+    }
+#endif
+
+    for (; length > 0; data++, length--)
+    {
+        if (*data == value)
+        {
+            return data;
+        }
+    }
+
+    return nullptr;
+}
+
+const void *Kraken::FindBytePair(const void *buffer, size_t length, unsigned char first, unsigned char second)
+{
+    const unsigned char *data = (const unsigned char *)buffer;
+
+#if !defined(KRAKEN_SCAN_SCALAR)
+    auto firstNeedle = SPLAT(first);
+    auto secondNeedle = SPLAT(second);
+
+    // Each block also reads the byte after it.
+    for (; length > s_VectorSize; data += s_VectorSize, length -= s_VectorSize)
+    {
+        auto mask = MatchPair(data, firstNeedle, secondNeedle);
+        if (mask != 0)
+        {
+            return data + FirstMatch(mask);
+        }
+    }
+#endif
+
+    for (; length > 1; data++, length--)
+    {
+        if ((data[0] == first) && (data[1] == second))
+        {
+            return data;
+        }
+    }
+
+    return nullptr;
+}
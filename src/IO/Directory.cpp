@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file Directory.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#include <Kraken/IO/Directory.h>
+#include <Kraken/Features.h>
+#include <unistd.h>
+
+using namespace Kraken;
+
+int Directory::Open(const char *path, EFileFlags flags)
+{
+    return File::Open(path, flags | EFileFlags::Read | EFileFlags::Directory);
+}
+
+#ifdef KRAKEN_OPT_DISABLE_GETDENTS64
+HANDLE_MISSING_FUNCTION(ssize_t, Directory::ReadEntries, membuf, DirectoryEntries &);
+#else
+ssize_t Directory::ReadEntries(membuf o_buffer, DirectoryEntries &o_entries)
+{
+    ssize_t res;
+
+    if (o_buffer.buffer == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`o_buffer`).");
+        return -EINVAL;
+    }
+
+    res = getdents64(m_descriptor, o_buffer.buffer, o_buffer.length);
+    if (res < 0)
+    {
+        res = -errno;
+        KRAKEN_PRINT("getdents64 failed. errno = %ld", -res);
+        return res;
+    }
+
+    o_entries = DirectoryEntries(o_buffer.buffer, (size_t)res);
+    return res;
+}
+#endif
+
+int Directory::Rewind()
+{
+    if (lseek(m_descriptor, 0, SEEK_SET) < 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int Directory::RemoveChild(const char *name, bool isDirectory)
+{
+    if (name == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: name");
+        return -EINVAL;
+    }
+
+    if (unlinkat(m_descriptor, name, isDirectory ? AT_REMOVEDIR : 0) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
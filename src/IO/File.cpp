@@ -26,8 +26,16 @@
  */
 
 #include "Kraken/IO/File.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <sys/syscall.h>
 #include <sys/ioctl.h>
+#include <sys/sysmacros.h>
+#include <linux/fs.h>
 #include <Kraken/Features.h>
 
 using namespace Kraken;
@@ -57,6 +65,293 @@ int File::Open(const char *path, EFileFlags flags, EFileModes mode)
     return 0;
 }
 
+int File::OpenAt(const File &directory, const char *path, EFileFlags flags, EFileModes mode)
+{
+    int descriptor;
+
+    if (path == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: path");
+        return -EINVAL;
+    }
+    else if (IsOpen())
+    {
+        KRAKEN_PRINT("Object already contains a valid descriptor.");
+        return -EBUSY;
+    }
+
+    descriptor = openat(directory.GetFileDescriptor(), path, (int)flags, (int)mode);
+    if (descriptor < 0)
+    {
+        return -errno;
+    }
+
+    m_descriptor = descriptor;
+    return 0;
+}
+
+#ifdef KRAKEN_OPT_DISABLE_OPENAT2
+HANDLE_MISSING_FUNCTION(int, File::OpenAt, const File &, const char *, EFileFlags, EResolveFlags, EFileModes);
+#else
+int File::OpenAt(const File &directory, const char *path, EFileFlags flags, EResolveFlags resolve, EFileModes mode)
+{
+    struct open_how how;
+    long descriptor;
+
+    if (path == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: path");
+        return -EINVAL;
+    }
+    else if (IsOpen())
+    {
+        KRAKEN_PRINT("Object already contains a valid descriptor.");
+        return -EBUSY;
+    }
+
+    memset(&how, 0, sizeof(how));
+    how.flags = (uint64_t)(unsigned int)flags;
+    how.resolve = (uint64_t)resolve;
+
+    // Unlike `openat`, a mode without a file creation flag is rejected.
+    if ((flags & (EFileFlags::Create | EFileFlags::TempFile)) != EFileFlags::None)
+    {
+        how.mode = (uint64_t)mode;
+    }
+
+    // glibc has no wrapper for openat2.
+    descriptor = syscall(SYS_openat2, directory.GetFileDescriptor(), path, &how, sizeof(how));
+    if (descriptor < 0)
+    {
+        return -errno;
+    }
+
+    m_descriptor = (fd_t)descriptor;
+    return 0;
+}
+#endif
+
+int File::OpenTemporary(const char *directory, EFileModes mode)
+{
+    char path[PATH_MAX] = "";
+    int descriptor;
+
+    if (directory == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: directory");
+        return -EINVAL;
+    }
+    else if (IsOpen())
+    {
+        KRAKEN_PRINT("Object already contains a valid descriptor.");
+        return -EBUSY;
+    }
+
+    descriptor = open(directory, O_TMPFILE | O_RDWR | O_CLOEXEC, (int)mode);
+
+    // Kernels without O_TMPFILE see just O_DIRECTORY, and fail with EISDIR.
+    if ((descriptor < 0) && ((errno == EOPNOTSUPP) || (errno == EISDIR)))
+    {
+        if (snprintf(path, sizeof(path), "%s/.kraken-XXXXXX", directory) >= (int)sizeof(path))
+        {
+            return -ENAMETOOLONG;
+        }
+
+        descriptor = mkostemp(path, O_CLOEXEC);
+        if ((descriptor >= 0) && (fchmod(descriptor, (mode_t)mode) != 0))
+        {
+            int err = -errno;
+            unlink(path);
+            close(descriptor);
+            return err;
+        }
+    }
+
+    if (descriptor < 0)
+    {
+        return -errno;
+    }
+
+    m_descriptor = descriptor;
+    m_isUnpublishedName = (path[0] != '\0');
+    return 0;
+}
+
+/**
+ * Flushes the directory entry of `path` by syncing its parent directory.
+ */
+static int SyncParentDirectory(const char *path)
+{
+    char directoryPath[PATH_MAX];
+    const char *separator = strrchr(path, '/');
+    size_t length;
+    File directory;
+    int err;
+
+    if (separator == nullptr)
+    {
+        strcpy(directoryPath, ".");
+    }
+    else
+    {
+        length = (separator == path) ? 1 : (size_t)(separator - path);
+        if (length >= sizeof(directoryPath))
+        {
+            return -ENAMETOOLONG;
+        }
+
+        memcpy(directoryPath, path, length);
+        directoryPath[length] = '\0';
+    }
+
+    err = directory.Open(directoryPath, EFileFlags::Read | EFileFlags::Directory | EFileFlags::CloseOnExec);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    return directory.Sync();
+}
+
+/**
+ * Gives an unnamed file the name `path`.
+ * Links the descriptor itself where permitted (`AT_EMPTY_PATH`), and through `/proc` otherwise.
+ */
+static int LinkUnnamed(fd_t descriptor, const char *path)
+{
+    char procPath[32];
+
+    if (linkat(descriptor, "", AT_FDCWD, path, AT_EMPTY_PATH) == 0)
+    {
+        return 0;
+    }
+    else if ((errno != ENOENT) && (errno != EPERM))
+    {
+        return -errno;
+    }
+
+    // Linking a descriptor needs `CAP_DAC_READ_SEARCH` on older kernels.
+    snprintf(procPath, sizeof(procPath), "/proc/self/fd/%d", descriptor);
+    if (linkat(AT_FDCWD, procPath, AT_FDCWD, path, AT_SYMLINK_FOLLOW) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::Publish(const char *path, bool sync)
+{
+    char procPath[32];
+    char temporaryPath[PATH_MAX];
+    struct stat info;
+    bool isUnnamed;
+    int err;
+
+    if (path == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: path");
+        return -EINVAL;
+    }
+
+    if (sync)
+    {
+        err = DataSync();
+        if (err != 0)
+        {
+            return err;
+        }
+    }
+
+    if (fstat(m_descriptor, &info) != 0)
+    {
+        return -errno;
+    }
+
+    snprintf(procPath, sizeof(procPath), "/proc/self/fd/%d", m_descriptor);
+    isUnnamed = (info.st_nlink == 0);
+
+    if (isUnnamed)
+    {
+        // `linkat` can't replace an existing file, so link next to it and rename over it.
+        if (snprintf(temporaryPath, sizeof(temporaryPath), "%s.kraken-%d-%d",
+                     path, (int)getpid(), m_descriptor) >= (int)sizeof(temporaryPath))
+        {
+            return -ENAMETOOLONG;
+        }
+
+        err = LinkUnnamed(m_descriptor, temporaryPath);
+        if (err == -EEXIST)
+        {
+            // A leftover of a crashed publish.
+            unlink(temporaryPath);
+            err = LinkUnnamed(m_descriptor, temporaryPath);
+        }
+
+        if (err != 0)
+        {
+            KRAKEN_PRINT("linkat failed. errno = %d", -err);
+            return err;
+        }
+    }
+    else
+    {
+        ssize_t length = readlink(procPath, temporaryPath, sizeof(temporaryPath) - 1);
+        if (length < 0)
+        {
+            return -errno;
+        }
+        else if ((size_t)length == sizeof(temporaryPath) - 1)
+        {
+            return -ENAMETOOLONG;
+        }
+
+        temporaryPath[length] = '\0';
+    }
+
+    if (rename(temporaryPath, path) != 0)
+    {
+        err = -errno;
+        KRAKEN_PRINT("rename failed. errno = %d", -err);
+
+        if (isUnnamed)
+        {
+            unlink(temporaryPath);
+        }
+
+        return err;
+    }
+
+    m_isUnpublishedName = false;
+    return sync ? SyncParentDirectory(path) : 0;
+}
+
+void File::RemoveUnpublishedName()
+{
+    char procPath[32];
+    char path[PATH_MAX];
+    struct stat openInfo;
+    struct stat pathInfo;
+    ssize_t length;
+
+    snprintf(procPath, sizeof(procPath), "/proc/self/fd/%d", m_descriptor);
+    length = readlink(procPath, path, sizeof(path) - 1);
+    if ((length <= 0) || ((size_t)length == sizeof(path) - 1))
+    {
+        KRAKEN_PRINT("Failed to resolve the name of an unpublished temporary file.");
+        return;
+    }
+
+    path[length] = '\0';
+
+    // Don't remove a file that took over the name (or a name that was already removed).
+    if ((fstat(m_descriptor, &openInfo) == 0) && (lstat(path, &pathInfo) == 0) &&
+        (openInfo.st_dev == pathInfo.st_dev) && (openInfo.st_ino == pathInfo.st_ino))
+    {
+        unlink(path);
+    }
+}
+
 ssize_t File::Read(void *o_buffer, size_t length)
 {
     ssize_t res = 0;
@@ -107,6 +402,14 @@ ssize_t File::ReadAt(void *o_buffer, size_t length, off_t offset)
         return -EINVAL;
     }
 
+#ifndef NDEBUG
+    res = ValidateDirectIO(o_buffer, length, offset);
+    if (res != 0)
+    {
+        return res;
+    }
+#endif
+
     res = pread(m_descriptor, o_buffer, length, offset);
     if (res < 0)
     {
@@ -127,6 +430,14 @@ ssize_t File::WriteAt(const void *buffer, size_t length, off_t offset)
         return -EINVAL;
     }
 
+#ifndef NDEBUG
+    res = ValidateDirectIO(buffer, length, offset);
+    if (res != 0)
+    {
+        return res;
+    }
+#endif
+
     res = pwrite(m_descriptor, buffer, length, offset);
     if (res < 0)
     {
@@ -137,6 +448,60 @@ ssize_t File::WriteAt(const void *buffer, size_t length, off_t offset)
     return res;
 }
 
+ssize_t File::ReadAt(void *o_buffer, size_t length, off_t offset, ERWFlags flags)
+{
+    iovec vector;
+
+    if (o_buffer == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`o_buffer`).");
+        return -EINVAL;
+    }
+
+#ifndef NDEBUG
+    if (offset >= 0)
+    {
+        int err = ValidateDirectIO(o_buffer, length, offset);
+        if (err != 0)
+        {
+            return err;
+        }
+    }
+#endif
+
+    vector.iov_base = o_buffer;
+    vector.iov_len = length;
+
+    return Read(&vector, 1, offset, flags);
+}
+
+ssize_t File::WriteAt(const void *buffer, size_t length, off_t offset, ERWFlags flags)
+{
+    iovec vector;
+
+    if (buffer == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`buffer`).");
+        return -EINVAL;
+    }
+
+#ifndef NDEBUG
+    if (offset >= 0)
+    {
+        int err = ValidateDirectIO(buffer, length, offset);
+        if (err != 0)
+        {
+            return err;
+        }
+    }
+#endif
+
+    vector.iov_base = const_cast<void *>(buffer);
+    vector.iov_len = length;
+
+    return Write(&vector, 1, offset, flags);
+}
+
 int File::IOControl(unsigned long command, void *parameter)
 {
     int res = 0;
@@ -151,11 +516,276 @@ int File::IOControl(unsigned long command, void *parameter)
     return res;
 }
 
+int File::Allocate(off_t offset, off_t length, EAllocateFlags flags)
+{
+    if (fallocate(m_descriptor, (int)flags, offset, length) != 0)
+    {
+        KRAKEN_PRINT("fallocate failed. errno = %d", errno);
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::Truncate(off_t length)
+{
+    if (ftruncate(m_descriptor, length) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::Advise(EAdvice advice, off_t offset, off_t length)
+{
+    // posix_fadvise returns the error number instead of setting errno.
+    int err = posix_fadvise(m_descriptor, offset, length, (int)advice);
+    if (err != 0)
+    {
+        KRAKEN_PRINT("posix_fadvise failed. err = %d", err);
+        return -err;
+    }
+
+    return 0;
+}
+
+int File::Readahead(off_t offset, size_t count)
+{
+    if (readahead(m_descriptor, offset, count) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::SyncRange(off_t offset, off_t length, ESyncRangeFlags flags)
+{
+    if (sync_file_range(m_descriptor, offset, length, (unsigned int)flags) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::Sync()
+{
+    if (fsync(m_descriptor) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::DataSync()
+{
+    if (fdatasync(m_descriptor) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::SetPipeCapacity(size_t capacity)
+{
+    if (fcntl(m_descriptor, F_SETPIPE_SZ, (int)capacity) < 0)
+    {
+        KRAKEN_PRINT("F_SETPIPE_SZ failed. errno = %d", errno);
+        return -errno;
+    }
+
+    return 0;
+}
+
+int File::GetPipeCapacity(size_t &o_capacity)
+{
+    int capacity = fcntl(m_descriptor, F_GETPIPE_SZ);
+    if (capacity < 0)
+    {
+        return -errno;
+    }
+
+    o_capacity = (size_t)capacity;
+    return 0;
+}
+
+int File::GetPendingLength(size_t &o_length)
+{
+    int length;
+    int err = IOControl(FIONREAD, &length);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    o_length = (size_t)length;
+    return 0;
+}
+
+/**
+ * Reads the logical block size of the block device behind a file system (`st_dev`) from sysfs.
+ */
+static int ReadDeviceLogicalBlockSize(dev_t device, size_t &o_blockSize)
+{
+    // Partitions don't have a queue of their own; theirs is the disk's.
+    static const char *const s_QueueDirectories[] = {"queue", "../queue"};
+    char path[80];
+    char text[16];
+    unsigned long blockSize;
+    ssize_t length;
+
+    for (const char *queue : s_QueueDirectories)
+    {
+        File attribute;
+
+        snprintf(path, sizeof(path), "/sys/dev/block/%u:%u/%s/logical_block_size", major(device), minor(device), queue);
+        if (attribute.Open(path, EFileFlags::Read | EFileFlags::CloseOnExec) != 0)
+        {
+            continue;
+        }
+
+        length = attribute.Read(text, sizeof(text) - 1);
+        if (length <= 0)
+        {
+            continue;
+        }
+
+        text[length] = '\0';
+        blockSize = strtoul(text, nullptr, 10);
+        if (blockSize > 0)
+        {
+            o_blockSize = (size_t)blockSize;
+            return 0;
+        }
+    }
+
+    return -ENOENT;
+}
+
+int File::GetLogicalBlockSize(size_t &o_blockSize)
+{
+    size_t memoryAlignment;
+    return GetDirectIOAlignment(memoryAlignment, o_blockSize);
+}
+
+int File::GetDirectIOAlignment(size_t &o_memoryAlignment, size_t &o_offsetAlignment)
+{
+    struct stat info;
+    int sectorSize = 0;
+    int err;
+
+#ifdef STATX_DIOALIGN
+    struct statx extendedInfo;
+
+    err = statx(m_descriptor, "", AT_EMPTY_PATH, STATX_DIOALIGN, &extendedInfo);
+    if ((err == 0) && (extendedInfo.stx_mask & STATX_DIOALIGN) && S_ISREG(extendedInfo.stx_mode) &&
+        (extendedInfo.stx_dio_offset_align == 0))
+    {
+        return -EOPNOTSUPP;
+    }
+    else if ((err == 0) && (extendedInfo.stx_mask & STATX_DIOALIGN) && (extendedInfo.stx_dio_offset_align != 0))
+    {
+        o_memoryAlignment = extendedInfo.stx_dio_mem_align;
+        o_offsetAlignment = extendedInfo.stx_dio_offset_align;
+        return 0;
+    }
+#endif
+
+    if (fstat(m_descriptor, &info) != 0)
+    {
+        return -errno;
+    }
+    else if (S_ISREG(info.st_mode))
+    {
+        // Kernels before `STATX_DIOALIGN` (6.1) don't report it, but regular files still support direct IO.
+        if (ReadDeviceLogicalBlockSize(info.st_dev, o_offsetAlignment) != 0)
+        {
+            o_offsetAlignment = (size_t)info.st_blksize;
+        }
+
+        o_memoryAlignment = o_offsetAlignment;
+        return 0;
+    }
+    else if (!S_ISBLK(info.st_mode))
+    {
+        return -EOPNOTSUPP;
+    }
+
+    err = IOControl(BLKSSZGET, &sectorSize);
+    if (err < 0)
+    {
+        return err;
+    }
+
+    o_memoryAlignment = (size_t)sectorSize;
+    o_offsetAlignment = (size_t)sectorSize;
+    return 0;
+}
+
+#ifndef NDEBUG
+int File::ValidateDirectIO(const void *buffer, size_t length, off_t offset)
+{
+    // `O_DIRECT` can be toggled with `F_SETFL`, so only the alignment is cached.
+    int flags = fcntl(m_descriptor, F_GETFL);
+    if ((flags < 0) || !(flags & O_DIRECT))
+    {
+        return 0;
+    }
+
+    if (m_directIODescriptor != m_descriptor)
+    {
+        if (GetDirectIOAlignment(m_directIOMemoryAlignment, m_directIOOffsetAlignment) != 0)
+        {
+            m_directIOMemoryAlignment = 0;
+            m_directIOOffsetAlignment = 0;
+        }
+
+        m_directIODescriptor = m_descriptor;
+    }
+
+    // Nothing to validate against when the requirements are unknown; let the kernel decide.
+    if (m_directIOMemoryAlignment == 0)
+    {
+        return 0;
+    }
+
+    size_t memoryAlignment = m_directIOMemoryAlignment;
+    size_t offsetAlignment = m_directIOOffsetAlignment;
+
+    if (((uintptr_t)buffer % memoryAlignment) != 0)
+    {
+        KRAKEN_PRINT("Misaligned direct IO buffer. `buffer` = %p, alignment = %lu", buffer, memoryAlignment);
+        return -EINVAL;
+    }
+    else if (((length % offsetAlignment) != 0) || (((size_t)offset % offsetAlignment) != 0))
+    {
+        KRAKEN_PRINT("Misaligned direct IO transfer. `length` = %lu, `offset` = %ld, alignment = %lu",
+                     length, offset, offsetAlignment);
+        return -EINVAL;
+    }
+
+    return 0;
+}
+#endif
+
 void File::Close()
 {
+    if (m_isUnpublishedName)
+    {
+        RemoveUnpublishedName();
+        m_isUnpublishedName = false;
+    }
+
     // There's nothing we can do really for close failure.
     close(m_descriptor);
     m_descriptor = -EBADFD;
+#ifndef NDEBUG
+    m_directIODescriptor = -EBADFD;
+#endif
 }
 
 int File::Pipe(File &o_readEnd, File &o_writeEnd, EFileFlags flags)
@@ -181,6 +811,17 @@ int File::Pipe(File &o_readEnd, File &o_writeEnd, EFileFlags flags)
     return 0;
 }
 
+ssize_t File::Splice(File &input, File &output, size_t length, ESpliceFlags flags)
+{
+    ssize_t res = splice(input.m_descriptor, nullptr, output.m_descriptor, nullptr, length, (unsigned int)flags);
+    if (res < 0)
+    {
+        return -errno;
+    }
+
+    return res;
+}
+
 #ifdef KRAKEN_OPT_DISABLE_READV
 HANDLE_MISSING_FUNCTION(ssize_t, File::Read, iovec *, size_t);
 #else
@@ -239,4 +880,34 @@ ssize_t File::Write(iovec *vectors, size_t vectorCount, off_t offset)
 
     return bytesWritten;
 }
-#endif
\ No newline at end of file
+#endif
+
+#ifdef KRAKEN_OPT_DISABLE_PREADV2
+HANDLE_MISSING_FUNCTION(ssize_t, File::Read, iovec *, size_t, off_t, ERWFlags);
+#else
+ssize_t File::Read(iovec *vectors, size_t vectorCount, off_t offset, ERWFlags flags)
+{
+    ssize_t bytesRead = preadv2(m_descriptor, vectors, (int)vectorCount, offset, (int)flags);
+    if (bytesRead < 0)
+    {
+        bytesRead = -errno;
+    }
+
+    return bytesRead;
+}
+#endif
+
+#ifdef KRAKEN_OPT_DISABLE_PWRITEV2
+HANDLE_MISSING_FUNCTION(ssize_t, File::Write, iovec *, size_t, off_t, ERWFlags);
+#else
+ssize_t File::Write(iovec *vectors, size_t vectorCount, off_t offset, ERWFlags flags)
+{
+    ssize_t bytesWritten = pwritev2(m_descriptor, vectors, (int)vectorCount, offset, (int)flags);
+    if (bytesWritten < 0)
+    {
+        bytesWritten = -errno;
+    }
+
+    return bytesWritten;
+}
+#endif
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file INotify.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#include <Kraken/IO/INotify.h>
+#include <unistd.h>
+
+using namespace Kraken;
+
+int INotify::Open(EINotifyFlags flags)
+{
+    int descriptor;
+
+    if (IsOpen())
+    {
+        return -EBUSY;
+    }
+
+    descriptor = inotify_init1((int)flags);
+    if (descriptor < 0)
+    {
+        return -errno;
+    }
+
+    m_descriptor = descriptor;
+
+    return 0;
+}
+
+int INotify::AddWatch(const char *path, EINotifyEvents events, int &o_watch)
+{
+    int watch;
+
+    if (path == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: path");
+        return -EINVAL;
+    }
+
+    watch = inotify_add_watch(m_descriptor, path, (uint32_t)events);
+    if (watch < 0)
+    {
+        return -errno;
+    }
+
+    o_watch = watch;
+
+    return 0;
+}
+
+int INotify::RemoveWatch(int watch)
+{
+    if (inotify_rm_watch(m_descriptor, watch) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+ssize_t INotify::ReadEvents(membuf o_buffer, INotifyEvents &o_events)
+{
+    ssize_t res;
+
+    if (o_buffer.buffer == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`o_buffer`).");
+        return -EINVAL;
+    }
+
+    res = read(m_descriptor, o_buffer.buffer, o_buffer.length);
+    if (res < 0)
+    {
+        return -errno;
+    }
+
+    o_events = INotifyEvents(o_buffer.buffer, (size_t)res);
+
+    return res;
+}
+
+void INotify::Close()
+{
+    if (close(m_descriptor) == 0)
+    {
+        m_descriptor = -EBADFD;
+    }
+}
@@ -0,0 +1,938 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file LogWriter.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#include <Kraken/IO/LogWriter.h>
+#include <Kraken/Checksum.h>
+#include <Kraken/IO/Directory.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+using namespace Kraken;
+
+/**
+ * A record waiting to be written by the leader.
+ * Lives on the stack of the appending thread until `done` is set.
+ */
+struct LogWriter::PendingRecord
+{
+    LogRecordHeader header;
+    const void *data;
+    bool sync;
+    bool done;
+    int result;
+    PendingRecord *next;
+};
+
+static const char s_SegmentSuffix[] = ".log";
+static const size_t s_SegmentIndexDigits = 20;
+static const size_t s_SegmentNameLength = s_SegmentIndexDigits + sizeof(s_SegmentSuffix) - 1;
+
+static uint64_t GetMonotonicMicros()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+static int CopyDirectory(char (&o_directory)[PATH_MAX], const char *directory)
+{
+    size_t length = strlen(directory);
+
+    // Leave room for '/' and the segment name.
+    if (length + 1 + s_SegmentNameLength >= PATH_MAX)
+    {
+        return -ENAMETOOLONG;
+    }
+
+    memcpy(o_directory, directory, length + 1);
+    return 0;
+}
+
+static int FormatSegmentPath(char (&o_path)[PATH_MAX], const char *directory, uint64_t index)
+{
+    int length = snprintf(o_path, sizeof(o_path), "%s/%0*" PRIu64 "%s",
+                          directory, (int)s_SegmentIndexDigits, index, s_SegmentSuffix);
+
+    if ((length < 0) || ((size_t)length >= sizeof(o_path)))
+    {
+        return -ENAMETOOLONG;
+    }
+
+    return 0;
+}
+
+static bool ParseSegmentName(const char *name, uint64_t &o_index)
+{
+    uint64_t index = 0;
+
+    if ((strlen(name) != s_SegmentNameLength) ||
+        (strcmp(name + s_SegmentIndexDigits, s_SegmentSuffix) != 0))
+    {
+        return false;
+    }
+
+    for (size_t digit = 0; digit < s_SegmentIndexDigits; digit++)
+    {
+        if ((name[digit] < '0') || (name[digit] > '9'))
+        {
+            return false;
+        }
+
+        index = index * 10 + (uint64_t)(name[digit] - '0');
+    }
+
+    o_index = index;
+    return true;
+}
+
+/**
+ * Finds the range of segment indices in a log directory.
+ *
+ * @return `0` on success; `-ENOENT` if there are no segments; `-errno` on error.
+ */
+static int FindSegments(const char *directory, uint64_t &o_first, uint64_t &o_last)
+{
+    unsigned char buffer[4096];
+    Directory listing;
+    DirectoryEntries entries;
+    uint64_t index;
+    bool found = false;
+    ssize_t res;
+
+    int err = listing.Open(directory);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    while ((res = listing.ReadEntries(buffer, entries)) > 0)
+    {
+        for (DirectoryEntry entry : entries)
+        {
+            if (!ParseSegmentName(entry.GetName(), index))
+            {
+                continue;
+            }
+
+            if (!found || (index < o_first))
+            {
+                o_first = index;
+            }
+            if (!found || (index > o_last))
+            {
+                o_last = index;
+            }
+            found = true;
+        }
+    }
+
+    if (res < 0)
+    {
+        return (int)res;
+    }
+
+    return found ? 0 : -ENOENT;
+}
+
+static uint32_t ComputeChecksum(uint32_t length, const void *payload)
+{
+    return Crc32c(payload, length, Crc32c(&length, sizeof(length)));
+}
+
+/**
+ * Reads a record header.
+ *
+ * @return `sizeof(LogRecordHeader)` on success; `0` at the end of the segment;
+ *          `-EBADMSG` for a partial header; `-errno` on error.
+ */
+static ssize_t ReadHeader(File &segment, off_t offset, LogRecordHeader &o_header)
+{
+    ssize_t res = segment.ReadAt(&o_header, sizeof(o_header), offset);
+
+    if ((res > 0) && ((size_t)res < sizeof(o_header)))
+    {
+        return -EBADMSG;
+    }
+
+    return res;
+}
+
+/**
+ * Finds the end of the last intact record in a segment.
+ *
+ * @param o_end     Output. The offset following the last intact record.
+ * @param o_isTorn  Output. `true` if the segment contains data past `o_end`.
+ *
+ * @return `0` on success; `-errno` on error.
+ */
+static int ScanSegment(File &segment, off_t &o_end, bool &o_isTorn)
+{
+    unsigned char chunk[4096];
+    LogRecordHeader header;
+    off_t offset = 0;
+
+    o_isTorn = false;
+
+    while (true)
+    {
+        ssize_t res = ReadHeader(segment, offset, header);
+        if (res == 0)
+        {
+            break;
+        }
+        else if (res == -EBADMSG)
+        {
+            o_isTorn = true;
+            break;
+        }
+        else if (res < 0)
+        {
+            return (int)res;
+        }
+
+        uint32_t checksum = Crc32c(&header.length, sizeof(header.length));
+        off_t position = offset + (off_t)sizeof(header);
+        size_t remaining = header.length;
+
+        while (remaining > 0)
+        {
+            res = segment.ReadAt(chunk, (remaining < sizeof(chunk)) ? remaining : sizeof(chunk), position);
+            if (res <= 0)
+            {
+                break;
+            }
+
+            checksum = Crc32c(chunk, (size_t)res, checksum);
+            position += res;
+            remaining -= (size_t)res;
+        }
+
+        if (res < 0)
+        {
+            return (int)res;
+        }
+        else if ((remaining > 0) || (checksum != header.checksum))
+        {
+            o_isTorn = true;
+            break;
+        }
+
+        offset = position;
+    }
+
+    o_end = offset;
+    return 0;
+}
+
+LogWriter::LogWriter() :
+        m_head(nullptr),
+        m_tail(nullptr),
+        m_leaderActive(false),
+        m_error(0),
+        m_isOpen(false),
+        m_segmentIndex(0),
+        m_segmentLength(0),
+        m_segmentSize(0),
+        m_syncBytes(0),
+        m_syncInterval(0),
+        m_unsyncedBytes(0),
+        m_unsyncedSince(0),
+        m_isSyncThreadRunning(false),
+        m_stopSyncThread(false)
+{
+    pthread_condattr_t attributes;
+
+    // The background sync waits for deadlines on the monotonic clock.
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+
+    pthread_mutex_init(&m_lock, nullptr);
+    pthread_cond_init(&m_idle, &attributes);
+    pthread_condattr_destroy(&attributes);
+    m_directory[0] = '\0';
+}
+
+LogWriter::~LogWriter()
+{
+    Close();
+
+    pthread_cond_destroy(&m_idle);
+    pthread_mutex_destroy(&m_lock);
+}
+
+int LogWriter::Open(const char *directory, size_t segmentSize, size_t syncBytes, uint64_t syncIntervalMicros)
+{
+    uint64_t first, last;
+    off_t end;
+    bool isTorn;
+    int err;
+
+    if (directory == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`directory`).");
+        return -EINVAL;
+    }
+    else if (segmentSize == 0)
+    {
+        KRAKEN_PRINT("Invalid segment size.");
+        return -EINVAL;
+    }
+    else if (IsOpen())
+    {
+        KRAKEN_PRINT("Log is already open.");
+        return -EBUSY;
+    }
+
+    err = CopyDirectory(m_directory, directory);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    err = FindSegments(m_directory, first, last);
+    if (err == -ENOENT)
+    {
+        err = OpenSegment(0, true);
+    }
+    else if (err == 0)
+    {
+        err = OpenSegment(last, false);
+    }
+
+    if (err != 0)
+    {
+        return err;
+    }
+
+    // Resume the last segment after its last intact record.
+    err = ScanSegment(m_segment, end, isTorn);
+    if ((err == 0) && isTorn)
+    {
+        KRAKEN_PRINT("Discarding torn tail of segment %" PRIu64 " at offset %ld.", m_segmentIndex, (long)end);
+        err = m_segment.Truncate(end);
+        if (err == 0)
+        {
+            err = m_segment.DataSync();
+        }
+    }
+
+    if (err != 0)
+    {
+        m_segment.Close();
+        return err;
+    }
+
+    m_segmentLength = (size_t)end;
+    m_segmentSize = segmentSize;
+    m_syncBytes = syncBytes;
+    m_syncInterval = syncIntervalMicros;
+    m_unsyncedBytes = 0;
+    m_error = 0;
+    m_isOpen = true;
+
+    if (syncIntervalMicros != 0)
+    {
+        m_stopSyncThread = false;
+
+        err = pthread_create(&m_syncThread, nullptr, SyncThreadEntry, this);
+        if (err != 0)
+        {
+            KRAKEN_PRINT("Failed to start the sync thread. err = %d", err);
+            m_isOpen = false;
+            m_segment.Close();
+            return -err;
+        }
+
+        m_isSyncThreadRunning = true;
+    }
+
+    return 0;
+}
+
+int LogWriter::Append(const void *record, size_t length, ELogAppendFlags flags)
+{
+    PendingRecord pending;
+
+    if ((record == nullptr) && (length > 0))
+    {
+        KRAKEN_PRINT("Null parameter (`record`).");
+        return -EINVAL;
+    }
+    else if (length > UINT32_MAX)
+    {
+        return -EMSGSIZE;
+    }
+
+    pending.header.length = (uint32_t)length;
+    pending.header.checksum = ComputeChecksum(pending.header.length, record);
+    pending.data = record;
+    pending.sync = ((flags & ELogAppendFlags::Sync) == ELogAppendFlags::Sync);
+    pending.done = false;
+    pending.result = 0;
+    pending.next = nullptr;
+
+    pthread_mutex_lock(&m_lock);
+
+    if (!IsOpen())
+    {
+        pthread_mutex_unlock(&m_lock);
+        return -EBADF;
+    }
+
+    if (m_tail != nullptr)
+    {
+        m_tail->next = &pending;
+    }
+    else
+    {
+        m_head = &pending;
+    }
+    m_tail = &pending;
+
+    while (!pending.done)
+    {
+        if (m_leaderActive)
+        {
+            pthread_cond_wait(&m_idle, &m_lock);
+            continue;
+        }
+
+        // Become the leader, and write as much of the queue as fits.
+        PendingRecord *first = m_head;
+        PendingRecord *current = m_head;
+        size_t count = 0, bytes = 0;
+        bool roll = false, sync = false;
+        size_t capacity = (m_segmentLength < m_segmentSize) ? (m_segmentSize - m_segmentLength) : 0;
+
+        if ((m_segmentLength > 0) && (sizeof(LogRecordHeader) + first->header.length > capacity))
+        {
+            roll = true;
+            capacity = m_segmentSize;
+        }
+
+        while ((current != nullptr) && (count < s_MaxBatchRecords))
+        {
+            size_t recordBytes = sizeof(LogRecordHeader) + current->header.length;
+            if ((count > 0) && (bytes + recordBytes > capacity))
+            {
+                break;
+            }
+
+            bytes += recordBytes;
+            sync = sync || current->sync;
+            count++;
+            current = current->next;
+        }
+
+        m_head = current;
+        if (current == nullptr)
+        {
+            m_tail = nullptr;
+        }
+
+        int err = m_error;
+        m_leaderActive = true;
+        pthread_mutex_unlock(&m_lock);
+
+        if (err == 0)
+        {
+            err = WriteBatch(first, count, bytes, roll, sync);
+        }
+
+        pthread_mutex_lock(&m_lock);
+
+        if (err != 0)
+        {
+            m_error = err;
+        }
+
+        for (current = first; count > 0; count--)
+        {
+            PendingRecord *next = current->next;
+
+            current->result = err;
+            current->done = true;
+            current = next;
+        }
+
+        m_leaderActive = false;
+        pthread_cond_broadcast(&m_idle);
+    }
+
+    pthread_mutex_unlock(&m_lock);
+
+    return pending.result;
+}
+
+int LogWriter::Sync()
+{
+    int err;
+
+    pthread_mutex_lock(&m_lock);
+
+    while (m_leaderActive)
+    {
+        pthread_cond_wait(&m_idle, &m_lock);
+    }
+
+    if (!IsOpen())
+    {
+        pthread_mutex_unlock(&m_lock);
+        return -EBADF;
+    }
+
+    err = m_error;
+    if ((err != 0) || (m_unsyncedBytes == 0))
+    {
+        pthread_mutex_unlock(&m_lock);
+        return err;
+    }
+
+    m_leaderActive = true;
+    pthread_mutex_unlock(&m_lock);
+
+    err = SyncSegment();
+
+    pthread_mutex_lock(&m_lock);
+
+    if (err != 0)
+    {
+        m_error = err;
+    }
+
+    m_leaderActive = false;
+    pthread_cond_broadcast(&m_idle);
+    pthread_mutex_unlock(&m_lock);
+
+    return err;
+}
+
+uint64_t LogWriter::GetSegmentIndex()
+{
+    uint64_t index;
+
+    pthread_mutex_lock(&m_lock);
+
+    // The leader rolls segments outside of the lock.
+    while (m_leaderActive)
+    {
+        pthread_cond_wait(&m_idle, &m_lock);
+    }
+
+    index = m_segmentIndex;
+    pthread_mutex_unlock(&m_lock);
+
+    return index;
+}
+
+size_t LogWriter::GetUnsyncedLength()
+{
+    size_t length;
+
+    pthread_mutex_lock(&m_lock);
+
+    while (m_leaderActive)
+    {
+        pthread_cond_wait(&m_idle, &m_lock);
+    }
+
+    length = m_unsyncedBytes;
+    pthread_mutex_unlock(&m_lock);
+
+    return length;
+}
+
+void LogWriter::Close()
+{
+    if (m_isSyncThreadRunning)
+    {
+        pthread_mutex_lock(&m_lock);
+        m_stopSyncThread = true;
+        pthread_cond_broadcast(&m_idle);
+        pthread_mutex_unlock(&m_lock);
+
+        pthread_join(m_syncThread, nullptr);
+        m_isSyncThreadRunning = false;
+    }
+
+    if (IsOpen())
+    {
+        Sync();
+
+        pthread_mutex_lock(&m_lock);
+        m_isOpen = false;
+        pthread_mutex_unlock(&m_lock);
+
+        m_segment.Close();
+    }
+}
+
+void *LogWriter::SyncThreadEntry(void *context)
+{
+    ((LogWriter *)context)->RunSyncLoop();
+    return nullptr;
+}
+
+void LogWriter::RunSyncLoop()
+{
+    pthread_mutex_lock(&m_lock);
+
+    while (!m_stopSyncThread)
+    {
+        // Leaders signal `m_idle` once they are done, so that's when new unsynced data may appear.
+        if (m_leaderActive || (m_unsyncedBytes == 0) || (m_error != 0))
+        {
+            pthread_cond_wait(&m_idle, &m_lock);
+            continue;
+        }
+
+        uint64_t deadline = m_unsyncedSince + m_syncInterval;
+        if (GetMonotonicMicros() < deadline)
+        {
+            struct timespec wakeup;
+
+            wakeup.tv_sec = (time_t)(deadline / 1000000);
+            wakeup.tv_nsec = (long)(deadline % 1000000) * 1000;
+            pthread_cond_timedwait(&m_idle, &m_lock, &wakeup);
+            continue;
+        }
+
+        // Take the leader's role, so no batch is written while syncing.
+        m_leaderActive = true;
+        pthread_mutex_unlock(&m_lock);
+
+        int err = SyncSegment();
+
+        pthread_mutex_lock(&m_lock);
+
+        if (err != 0)
+        {
+            m_error = err;
+        }
+
+        m_leaderActive = false;
+        pthread_cond_broadcast(&m_idle);
+    }
+
+    pthread_mutex_unlock(&m_lock);
+}
+
+int LogWriter::OpenSegment(uint64_t index, bool create)
+{
+    char path[PATH_MAX];
+    EFileFlags flags = EFileFlags::ReadWrite | EFileFlags::Append | EFileFlags::CloseOnExec;
+    int err;
+
+    if (create)
+    {
+        flags = flags | EFileFlags::Create | EFileFlags::ExpectCreation;
+    }
+
+    err = FormatSegmentPath(path, m_directory, index);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    err = m_segment.Open(path, flags);
+    if (err != 0)
+    {
+        KRAKEN_PRINT("Failed to open segment %s. err = %d", path, err);
+        return err;
+    }
+
+    if (create)
+    {
+        // Make the new segment's directory entry durable.
+        File directory;
+
+        err = directory.Open(m_directory, EFileFlags::Read | EFileFlags::Directory | EFileFlags::CloseOnExec);
+        if (err == 0)
+        {
+            err = directory.Sync();
+        }
+
+        if (err != 0)
+        {
+            m_segment.Close();
+            return err;
+        }
+    }
+
+    m_segmentIndex = index;
+    m_segmentLength = 0;
+
+    return 0;
+}
+
+int LogWriter::RollSegment()
+{
+    int err = SyncSegment();
+    if (err != 0)
+    {
+        return err;
+    }
+
+    m_segment.Close();
+
+    return OpenSegment(m_segmentIndex + 1, true);
+}
+
+int LogWriter::WriteBatch(PendingRecord *first, size_t count, size_t bytes, bool roll, bool sync)
+{
+    iovec vectors[2 * s_MaxBatchRecords];
+    iovec *current = vectors;
+    size_t remaining = 0;
+    int err;
+
+    if (roll)
+    {
+        err = RollSegment();
+        if (err != 0)
+        {
+            return err;
+        }
+    }
+
+    for (PendingRecord *record = first; remaining < 2 * count; record = record->next)
+    {
+        vectors[remaining].iov_base = &record->header;
+        vectors[remaining++].iov_len = sizeof(record->header);
+        vectors[remaining].iov_base = (void *)record->data;
+        vectors[remaining++].iov_len = record->header.length;
+    }
+
+    // `File` only exposes fixed-size vector writes, so the batch is written with `writev` directly.
+    while (remaining > 0)
+    {
+        ssize_t res = writev(m_segment.GetFileDescriptor(), current, (int)remaining);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            KRAKEN_PRINT("writev failed. errno = %d", errno);
+            return -errno;
+        }
+
+        while ((remaining > 0) && ((size_t)res >= current->iov_len))
+        {
+            res -= current->iov_len;
+            current++;
+            remaining--;
+        }
+
+        if (remaining > 0)
+        {
+            current->iov_base = (unsigned char *)current->iov_base + res;
+            current->iov_len -= (size_t)res;
+        }
+    }
+
+    if (m_unsyncedBytes == 0)
+    {
+        m_unsyncedSince = GetMonotonicMicros();
+    }
+
+    m_segmentLength += bytes;
+    m_unsyncedBytes += bytes;
+
+    return ShouldSync(sync) ? SyncSegment() : 0;
+}
+
+int LogWriter::SyncSegment()
+{
+    int err = m_segment.DataSync();
+    if (err == 0)
+    {
+        m_unsyncedBytes = 0;
+    }
+
+    return err;
+}
+
+bool LogWriter::ShouldSync(bool forced)
+{
+    if (forced || ((m_syncBytes == 0) && (m_syncInterval == 0)))
+    {
+        return true;
+    }
+
+    if ((m_syncBytes != 0) && (m_unsyncedBytes >= m_syncBytes))
+    {
+        return true;
+    }
+
+    return (m_syncInterval != 0) && (GetMonotonicMicros() - m_unsyncedSince >= m_syncInterval);
+}
+
+int LogScanner::Open(const char *directory)
+{
+    uint64_t first, last;
+    int err;
+
+    if (directory == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`directory`).");
+        return -EINVAL;
+    }
+    else if (m_segment.IsOpen())
+    {
+        KRAKEN_PRINT("Scanner is already open.");
+        return -EBUSY;
+    }
+
+    err = CopyDirectory(m_directory, directory);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    err = FindSegments(m_directory, first, last);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    m_lastSegmentIndex = last;
+    m_isTornTail = false;
+
+    return OpenSegment(first);
+}
+
+ssize_t LogScanner::Next(membuf o_buffer)
+{
+    LogRecordHeader header;
+    ssize_t res;
+
+    if (!m_segment.IsOpen() || m_isTornTail)
+    {
+        return 0;
+    }
+
+    while (true)
+    {
+        res = ReadHeader(m_segment, m_offset, header);
+        if ((res == 0) && (m_segmentIndex < m_lastSegmentIndex))
+        {
+            res = OpenSegment(m_segmentIndex + 1);
+            if (res != 0)
+            {
+                return res;
+            }
+
+            continue;
+        }
+
+        break;
+    }
+
+    if (res == 0)
+    {
+        return 0;
+    }
+    else if ((res < 0) && (res != -EBADMSG))
+    {
+        return res;
+    }
+
+    if ((res > 0) && (header.length > o_buffer.length))
+    {
+        struct stat info;
+
+        if (fstat(m_segment.GetFileDescriptor(), &info) != 0)
+        {
+            return -errno;
+        }
+
+        // Only an intact record is too large; a length past the end of the segment is corrupt.
+        if (header.length <= (uint64_t)info.st_size - (uint64_t)m_offset - sizeof(header))
+        {
+            return -EMSGSIZE;
+        }
+
+        res = -EBADMSG;
+    }
+
+    if (res > 0)
+    {
+        res = m_segment.ReadAt(o_buffer.buffer, header.length, m_offset + (off_t)sizeof(header));
+        if (res < 0)
+        {
+            return res;
+        }
+        else if (((size_t)res == header.length) &&
+                 (ComputeChecksum(header.length, o_buffer.buffer) == header.checksum))
+        {
+            m_offset += (off_t)(sizeof(header) + header.length);
+            return res;
+        }
+    }
+
+    // A record is either partial, or its checksum doesn't match.
+    if (m_segmentIndex == m_lastSegmentIndex)
+    {
+        m_isTornTail = true;
+        return 0;
+    }
+
+    KRAKEN_PRINT("Corrupted record in segment %" PRIu64 " at offset %ld.", m_segmentIndex, (long)m_offset);
+    return -EBADMSG;
+}
+
+int LogScanner::OpenSegment(uint64_t index)
+{
+    char path[PATH_MAX];
+    int err;
+
+    err = FormatSegmentPath(path, m_directory, index);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    m_segment.Close();
+    err = m_segment.Open(path, EFileFlags::Read | EFileFlags::CloseOnExec);
+    if (err != 0)
+    {
+        KRAKEN_PRINT("Failed to open segment %s. err = %d", path, err);
+        return err;
+    }
+
+    m_segmentIndex = index;
+    m_offset = 0;
+
+    return 0;
+}
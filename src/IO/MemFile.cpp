@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file MemFile.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#include <Kraken/IO/MemFile.h>
+#include <Kraken/Features.h>
+#include <unistd.h>
+
+using namespace Kraken;
+
+#ifdef KRAKEN_OPT_DISABLE_MEMFD_CREATE
+HANDLE_MISSING_FUNCTION(int, MemFile::Open, const char *, size_t, EMemFileFlags);
+#else
+int MemFile::Open(const char *name, size_t size, EMemFileFlags flags)
+{
+    int descriptor;
+
+    if (name == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter: name");
+        return -EINVAL;
+    }
+    else if (IsOpen())
+    {
+        KRAKEN_PRINT("Object already contains a valid descriptor.");
+        return -EBUSY;
+    }
+
+    descriptor = memfd_create(name, (unsigned int)flags);
+    if (descriptor < 0)
+    {
+        KRAKEN_PRINT("memfd_create failed. errno = %d", errno);
+        return -errno;
+    }
+
+    if (ftruncate(descriptor, (off_t)size) != 0)
+    {
+        int err = -errno;
+        KRAKEN_PRINT("Failed to size the memory file. errno = %d", -err);
+        close(descriptor);
+        return err;
+    }
+
+    m_descriptor = descriptor;
+    return 0;
+}
+#endif
+
+int MemFile::AddSeals(ESeals seals)
+{
+    if (fcntl(m_descriptor, F_ADD_SEALS, (int)seals) != 0)
+    {
+        return -errno;
+    }
+
+    return 0;
+}
+
+int MemFile::GetSeals(ESeals &o_seals)
+{
+    int seals = fcntl(m_descriptor, F_GET_SEALS);
+    if (seals < 0)
+    {
+        return -errno;
+    }
+
+    o_seals = (ESeals)seals;
+    return 0;
+}
+
+int MemFile::GetSize(size_t &o_size)
+{
+    struct stat info;
+
+    if (fstat(m_descriptor, &info) != 0)
+    {
+        return -errno;
+    }
+
+    o_size = (size_t)info.st_size;
+    return 0;
+}
+
+int MemFile::Map(MemoryMapping &o_mapping, EProtection protection)
+{
+    size_t size;
+    int err = GetSize(size);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    return o_mapping.Map(*this, size, protection, EMappingFlags::Shared);
+}
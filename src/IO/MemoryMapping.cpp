@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file MemoryMapping.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+#include <Kraken/IO/MemoryMapping.h>
+#include <unistd.h>
+
+using namespace Kraken;
+
+int MemoryMapping::Map(const File &file, size_t length, EProtection protection, EMappingFlags flags, off_t offset)
+{
+    return Map(file.GetFileDescriptor(), length, protection, flags, offset);
+}
+
+int MemoryMapping::MapAnonymous(size_t length, EProtection protection, EMappingFlags flags)
+{
+    return Map(-1, length, protection, (EMappingFlags)(primitivize(flags) | MAP_ANONYMOUS), 0);
+}
+
+int MemoryMapping::Advise(EMemoryAdvice advice)
+{
+    if (!IsMapped())
+    {
+        return -EINVAL;
+    }
+
+    if (madvise(m_address, m_length, (int)advice) != 0)
+    {
+        KRAKEN_PRINT("madvise failed. errno = %d", errno);
+        return -errno;
+    }
+
+    return 0;
+}
+
+int MemoryMapping::Lock()
+{
+    if (!IsMapped())
+    {
+        return -EINVAL;
+    }
+
+    if (mlock(m_address, m_length) != 0)
+    {
+        KRAKEN_PRINT("mlock failed. errno = %d", errno);
+        return -errno;
+    }
+
+    return 0;
+}
+
+int MemoryMapping::Trim(size_t offset, size_t length)
+{
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    unsigned char *start = (unsigned char *)m_address + offset;
+
+    if (!IsMapped())
+    {
+        return -EINVAL;
+    }
+
+    if ((length == 0) || (offset > m_length) || (length > m_length - offset) ||
+        ((offset | length) & (pageSize - 1)) != 0)
+    {
+        KRAKEN_PRINT("Invalid range. `offset` = %lu, `length` = %lu", offset, length);
+        return -EINVAL;
+    }
+
+    if ((offset > 0) && (munmap(m_address, offset) != 0))
+    {
+        KRAKEN_PRINT("munmap failed. errno = %d", errno);
+        return -errno;
+    }
+
+    if ((offset + length < m_length) && (munmap(start + length, m_length - offset - length) != 0))
+    {
+        // The head is already gone.
+        m_address = start;
+        m_length -= offset;
+
+        KRAKEN_PRINT("munmap failed. errno = %d", errno);
+        return -errno;
+    }
+
+    m_address = start;
+    m_length = length;
+
+    return 0;
+}
+
+void MemoryMapping::Unmap()
+{
+    if (IsMapped())
+    {
+        munmap(m_address, m_length);
+        m_address = nullptr;
+        m_length = 0;
+    }
+}
+
+int MemoryMapping::Map(fd_t descriptor, size_t length, EProtection protection, EMappingFlags flags, off_t offset)
+{
+    void *address;
+
+    if (IsMapped())
+    {
+        KRAKEN_PRINT("Object already holds a mapping.");
+        return -EBUSY;
+    }
+
+    address = mmap(nullptr, length, (int)protection, (int)flags, descriptor, offset);
+    if (address == MAP_FAILED)
+    {
+        KRAKEN_PRINT("mmap failed. errno = %d", errno);
+        return -errno;
+    }
+
+    m_address = address;
+    m_length = length;
+
+    return 0;
+}
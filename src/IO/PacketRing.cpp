@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file PacketRing.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+
+#include <Kraken/IO/PacketRing.h>
+#include <poll.h>
+#include <time.h>
+
+using namespace Kraken;
+
+namespace
+{
+    /**
+     * Removes a ring from a socket. The ring must be unmapped.
+     */
+    template <typename RingOption>
+    void TearDown(PacketSocket &socket)
+    {
+        struct tpacket_req3 request;
+
+        memset(&request, 0, sizeof(request));
+        socket.SetOption<RingOption>(request);
+    }
+
+    /**
+     * Switches a socket to TPACKET_V3 and sets up a ring on it.
+     *
+     * @return `0` on success; `-EBUSY` if the socket already has a ring; `-errno` on error.
+     */
+    template <typename RingOption>
+    int SetUp(PacketSocket &socket, const struct tpacket_req3 &request)
+    {
+        // The kernel refuses both once a ring exists; the version can't change under a ring.
+        int err = socket.SetOption<SocketOption::PacketVersion>(TPACKET_V3);
+        if (err == 0)
+        {
+            err = socket.SetOption<RingOption>(request);
+        }
+
+        if (err == -EBUSY)
+        {
+            KRAKEN_PRINT("The socket already has a ring; use a socket per ring.");
+        }
+
+        return err;
+    }
+
+    int64_t GetMonotonicMillis()
+    {
+        struct timespec now;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (int64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+    }
+}
+
+int PacketReceiveRing::Open(PacketSocket &socket, uint32_t blockSize, uint32_t blockCount, uint32_t blockTimeout)
+{
+    struct tpacket_req3 request;
+    int err;
+
+    if (IsOpen())
+    {
+        return -EBUSY;
+    }
+
+    if ((blockSize == 0) || (blockCount == 0))
+    {
+        return -EINVAL;
+    }
+
+    // With TPACKET_V3 the kernel packs frames by their actual size; the frame size only has to be consistent.
+    memset(&request, 0, sizeof(request));
+    request.tp_block_size = blockSize;
+    request.tp_block_nr = blockCount;
+    request.tp_frame_size = blockSize;
+    request.tp_frame_nr = blockCount;
+    request.tp_retire_blk_tov = blockTimeout;
+
+    err = SetUp<SocketOption::PacketReceiveRing>(socket, request);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    err = m_mapping.Map(socket, (size_t)blockSize * blockCount);
+    if (err != 0)
+    {
+        TearDown<SocketOption::PacketReceiveRing>(socket);
+        return err;
+    }
+
+    m_socket = &socket;
+    m_blockSize = blockSize;
+    m_blockCount = blockCount;
+    m_index = 0;
+
+    return 0;
+}
+
+int PacketReceiveRing::Next(PacketBlock &o_block, int timeout)
+{
+    struct pollfd pollDescriptor;
+    tpacket_block_desc *block;
+    int64_t deadline;
+    int remaining = timeout;
+
+    if (!IsOpen())
+    {
+        return -EBADF;
+    }
+
+    block = GetBlock(m_index);
+    pollDescriptor.fd = m_socket->GetFileDescriptor();
+    pollDescriptor.events = POLLIN;
+    deadline = (timeout > 0) ? GetMonotonicMillis() + timeout : 0;
+
+    while ((__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0)
+    {
+        if (timeout > 0)
+        {
+            int64_t left = deadline - GetMonotonicMillis();
+            remaining = (left > 0) ? (int)left : 0;
+        }
+
+        pollDescriptor.revents = 0;
+
+        int res = poll(&pollDescriptor, 1, remaining);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -errno;
+        }
+        else if (res == 0)
+        {
+            return -EAGAIN;
+        }
+
+        // `POLLERR` is reported regardless of `events`, and stays up until it is dealt with.
+        if ((pollDescriptor.revents & POLLERR) != 0)
+        {
+            int error = 0;
+
+            res = m_socket->GetOption<SocketOption::Error>(error);
+            if (res != 0)
+            {
+                return res;
+            }
+
+            return (error != 0) ? -error : -ENOMSG;
+        }
+    }
+
+    o_block.m_block = block;
+    return 0;
+}
+
+void PacketReceiveRing::Release(PacketBlock &block)
+{
+    if ((block.m_block == nullptr) || (block.m_block != GetBlock(m_index)))
+    {
+        return;
+    }
+
+    __atomic_store_n(&block.m_block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+    block.m_block = nullptr;
+    m_index = (m_index + 1) % m_blockCount;
+}
+
+void PacketReceiveRing::Close()
+{
+    if (!IsOpen())
+    {
+        return;
+    }
+
+    m_mapping.Unmap();
+
+    if (m_socket->IsOpen())
+    {
+        TearDown<SocketOption::PacketReceiveRing>(*m_socket);
+    }
+
+    m_socket = nullptr;
+    m_blockSize = 0;
+    m_blockCount = 0;
+    m_index = 0;
+}
+
+int PacketTransmitRing::Open(PacketSocket &socket, uint32_t blockSize, uint32_t blockCount, uint32_t frameSize)
+{
+    struct tpacket_req3 request;
+    int err;
+
+    if (IsOpen())
+    {
+        return -EBUSY;
+    }
+
+    if ((blockSize == 0) || (blockCount == 0) || (frameSize <= s_DataOffset) || ((blockSize % frameSize) != 0))
+    {
+        return -EINVAL;
+    }
+
+    // Block transmission isn't supported; a TPACKET_V3 transmit ring is a plain array of frame slots.
+    memset(&request, 0, sizeof(request));
+    request.tp_block_size = blockSize;
+    request.tp_block_nr = blockCount;
+    request.tp_frame_size = frameSize;
+    request.tp_frame_nr = (blockSize / frameSize) * blockCount;
+
+    err = SetUp<SocketOption::PacketTransmitRing>(socket, request);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    err = m_mapping.Map(socket, (size_t)blockSize * blockCount);
+    if (err != 0)
+    {
+        TearDown<SocketOption::PacketTransmitRing>(socket);
+        return err;
+    }
+
+    m_socket = &socket;
+    m_frameSize = frameSize;
+    m_frameCount = request.tp_frame_nr;
+    m_index = 0;
+
+    return 0;
+}
+
+bool PacketTransmitRing::IsAvailable() const
+{
+    uint32_t status = __atomic_load_n(&GetFrame(m_index)->tp_status, __ATOMIC_ACQUIRE);
+
+    // A frame the kernel refused (with `SocketOption::PacketLoss` off) is reclaimed as well.
+    return (status == TP_STATUS_AVAILABLE) || (status == TP_STATUS_WRONG_FORMAT);
+}
+
+membuf PacketTransmitRing::Acquire()
+{
+    if (!IsOpen() || !IsAvailable())
+    {
+        return membuf(nullptr, 0);
+    }
+
+    return membuf((uint8_t *)GetFrame(m_index) + s_DataOffset, GetMaxFrameLength());
+}
+
+int PacketTransmitRing::Commit(size_t length)
+{
+    tpacket3_hdr *frame;
+
+    if (!IsOpen() || !IsAvailable())
+    {
+        return -ENOBUFS;
+    }
+
+    if (length > GetMaxFrameLength())
+    {
+        return -EMSGSIZE;
+    }
+
+    frame = GetFrame(m_index);
+    frame->tp_len = (uint32_t)length;
+    frame->tp_snaplen = (uint32_t)length;
+    frame->tp_next_offset = 0;
+    __atomic_store_n(&frame->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+    m_index = (m_index + 1) % m_frameCount;
+    return 0;
+}
+
+ssize_t PacketTransmitRing::Flush(bool wait)
+{
+    ssize_t res;
+
+    if (!IsOpen())
+    {
+        return -EBADF;
+    }
+
+    res = send(m_socket->GetFileDescriptor(), nullptr, 0, wait ? 0 : MSG_DONTWAIT);
+    if (res < 0)
+    {
+        KRAKEN_PRINT("send failed. errno = %d", errno);
+        return -errno;
+    }
+
+    return res;
+}
+
+void PacketTransmitRing::Close()
+{
+    if (!IsOpen())
+    {
+        return;
+    }
+
+    m_mapping.Unmap();
+
+    if (m_socket->IsOpen())
+    {
+        TearDown<SocketOption::PacketTransmitRing>(*m_socket);
+    }
+
+    m_socket = nullptr;
+    m_frameSize = 0;
+    m_frameCount = 0;
+    m_index = 0;
+}
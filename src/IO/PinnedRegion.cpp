@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file PinnedRegion.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+
+
+#include <Kraken/IO/PinnedRegion.h>
+#include <stdint.h>
+#include <unistd.h>
+
+using namespace Kraken;
+
+constexpr size_t PinnedRegion::s_HugePageSize;
+
+int PinnedRegion::Open(size_t length, EPinnedRegionFlags flags)
+{
+    int err;
+
+    if (IsOpen())
+    {
+        KRAKEN_PRINT("Region is already open.");
+        return -EBUSY;
+    }
+
+    if (length == 0)
+    {
+        KRAKEN_PRINT("Invalid parameter (`length`).");
+        return -EINVAL;
+    }
+
+    length = (length + s_HugePageSize - 1) & ~(s_HugePageSize - 1);
+
+    // Reserved huge pages are often not configured (`vm.nr_hugepages`); fall back to regular pages.
+    // The default huge page size may be larger (e.g. 1GB), so ask for `s_HugePageSize` explicitly.
+    if ((flags & EPinnedRegionFlags::HugeTLB) == EPinnedRegionFlags::HugeTLB)
+    {
+        m_isHugeTLB = (m_mapping.MapAnonymous(length, EProtection::ReadWrite,
+                                              EMappingFlags::Private | EMappingFlags::HugeTLB |
+                                              EMappingFlags::HugePageSize2MB) == 0);
+    }
+
+    if (!m_isHugeTLB)
+    {
+        if ((flags & EPinnedRegionFlags::TransparentHugePages) == EPinnedRegionFlags::TransparentHugePages)
+        {
+            err = MapHugePageAligned(length);
+            if (err != 0)
+            {
+                return err;
+            }
+
+            // Transparent huge pages may be disabled system-wide; that only costs performance.
+            (void)m_mapping.Advise(EMemoryAdvice::HugePage);
+        }
+        else
+        {
+            err = m_mapping.MapAnonymous(length);
+            if (err != 0)
+            {
+                return err;
+            }
+        }
+    }
+
+    // Locking faults the pages in as well.
+    if ((flags & EPinnedRegionFlags::Lock) == EPinnedRegionFlags::Lock)
+    {
+        err = m_mapping.Lock();
+    }
+    else if ((flags & EPinnedRegionFlags::Prefault) == EPinnedRegionFlags::Prefault)
+    {
+        err = Prefault();
+    }
+    else
+    {
+        err = 0;
+    }
+
+    if (err != 0)
+    {
+        Close();
+        return err;
+    }
+
+    m_offset = 0;
+    return 0;
+}
+
+int PinnedRegion::MapHugePageAligned(size_t length)
+{
+    uintptr_t address;
+    size_t offset;
+    int err;
+
+    // Only the huge-page-aligned parts of a mapping can be backed by huge pages,
+    // so over-map by a huge page and trim the mapping to an aligned start.
+    if (length > SIZE_MAX - s_HugePageSize)
+    {
+        return -ENOMEM;
+    }
+
+    err = m_mapping.MapAnonymous(length + s_HugePageSize);
+    if (err != 0)
+    {
+        return err;
+    }
+
+    address = (uintptr_t)m_mapping.GetAddress();
+    offset = (size_t)(((address + s_HugePageSize - 1) & ~(uintptr_t)(s_HugePageSize - 1)) - address);
+
+    err = m_mapping.Trim(offset, length);
+    if (err != 0)
+    {
+        m_mapping.Unmap();
+    }
+
+    return err;
+}
+
+membuf PinnedRegion::Allocate(size_t length, size_t alignment)
+{
+    if (!IsOpen() || (alignment == 0) || ((alignment & (alignment - 1)) != 0))
+    {
+        return membuf(nullptr, 0);
+    }
+
+    size_t start = (m_offset + alignment - 1) & ~(alignment - 1);
+    if ((start < m_offset) || (start > GetLength()) || (length > GetLength() - start))
+    {
+        return membuf(nullptr, 0);
+    }
+
+    m_offset = start + length;
+    return membuf((unsigned char *)m_mapping.GetAddress() + start, length);
+}
+
+void PinnedRegion::Close()
+{
+    m_mapping.Unmap();
+    m_offset = 0;
+    m_isHugeTLB = false;
+}
+
+int PinnedRegion::Prefault()
+{
+    // Other errors fail the open; touching the pages instead would get the process killed.
+    int err = m_mapping.Advise(EMemoryAdvice::PopulateWrite);
+    if (err != -EINVAL)
+    {
+        return err;
+    }
+
+    // Kernels older than 5.14 don't know `MADV_POPULATE_WRITE`; touch every page instead.
+    volatile unsigned char *address = (volatile unsigned char *)m_mapping.GetAddress();
+    size_t pageSize = m_isHugeTLB ? s_HugePageSize : (size_t)sysconf(_SC_PAGESIZE);
+
+    for (size_t offset = 0; offset < GetLength(); offset += pageSize)
+    {
+        address[offset] = 0;
+    }
+
+    return 0;
+}
@@ -0,0 +1,463 @@
+/**
+ * Copyright (c) 2016 Gilad Naaman
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file URing.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <Kraken/IO/URing.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace Kraken;
+
+// glibc does not wrap the io_uring syscalls.
+static inline int io_uring_setup(unsigned int entries, io_uring_params *params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static inline int io_uring_enter(int descriptor, unsigned int toSubmit, unsigned int minComplete, unsigned int flags)
+{
+    return (int)syscall(__NR_io_uring_enter, descriptor, toSubmit, minComplete, flags, nullptr, 0);
+}
+
+static inline int io_uring_register(int descriptor, unsigned int opcode, void *arg, unsigned int argCount)
+{
+    return (int)syscall(__NR_io_uring_register, descriptor, opcode, arg, argCount);
+}
+
+static inline uint64_t MakeUserData(void *tag, EURingOperation operation)
+{
+    return (uint64_t)(uintptr_t)tag | (uint64_t)operation;
+}
+
+int URing::Open(unsigned int entries, EURingFlags flags)
+{
+    io_uring_params params;
+    int descriptor;
+
+    if (IsOpen())
+    {
+        return -EBUSY;
+    }
+
+    memset(&params, 0, sizeof(params));
+    params.flags = (uint32_t)flags;
+
+    descriptor = io_uring_setup(entries, &params);
+    if (descriptor < 0)
+    {
+        return -errno;
+    }
+
+    m_descriptor = descriptor;
+    m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (m_completionRingSize > m_submissionRingSize)
+        {
+            m_submissionRingSize = m_completionRingSize;
+        }
+        m_completionRingSize = m_submissionRingSize;
+    }
+
+    m_submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            m_descriptor, IORING_OFF_SQ_RING);
+    if (m_submissionRing == MAP_FAILED)
+    {
+        m_submissionRing = nullptr;
+        goto error;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        m_completionRing = m_submissionRing;
+    }
+    else
+    {
+        m_completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                m_descriptor, IORING_OFF_CQ_RING);
+        if (m_completionRing == MAP_FAILED)
+        {
+            m_completionRing = nullptr;
+            goto error;
+        }
+    }
+
+    m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+    m_submissionEntries = (io_uring_sqe *)mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_POPULATE, m_descriptor, IORING_OFF_SQES);
+    if (m_submissionEntries == MAP_FAILED)
+    {
+        m_submissionEntries = nullptr;
+        goto error;
+    }
+
+    m_sqHead = (uint32_t *)((uint8_t *)m_submissionRing + params.sq_off.head);
+    m_sqTail = (uint32_t *)((uint8_t *)m_submissionRing + params.sq_off.tail);
+    m_sqMask = *(uint32_t *)((uint8_t *)m_submissionRing + params.sq_off.ring_mask);
+    m_sqEntries = *(uint32_t *)((uint8_t *)m_submissionRing + params.sq_off.ring_entries);
+
+    m_cqHead = (uint32_t *)((uint8_t *)m_completionRing + params.cq_off.head);
+    m_cqTail = (uint32_t *)((uint8_t *)m_completionRing + params.cq_off.tail);
+    m_cqMask = *(uint32_t *)((uint8_t *)m_completionRing + params.cq_off.ring_mask);
+    m_cqes = (io_uring_cqe *)((uint8_t *)m_completionRing + params.cq_off.cqes);
+
+    // The submission array is an indirection we do not need; map each slot to its own entry once.
+    {
+        uint32_t *array = (uint32_t *)((uint8_t *)m_submissionRing + params.sq_off.array);
+        for (uint32_t index = 0; index < m_sqEntries; index++)
+        {
+            array[index] = index;
+        }
+    }
+
+    m_submissionTail = *m_sqTail;
+    m_submittedTail = m_submissionTail;
+
+    return 0;
+
+error:
+    int err = -errno;
+    KRAKEN_PRINT("Failed to map io_uring rings. errno = %d", err);
+    Close();
+    return err;
+}
+
+io_uring_sqe *URing::GetSubmissionEntry()
+{
+    uint32_t head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+
+    if (m_submissionTail - head >= m_sqEntries)
+    {
+        // The queue is full; flush it to the kernel and try again.
+        if (Submit() < 0)
+        {
+            return nullptr;
+        }
+
+        head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        if (m_submissionTail - head >= m_sqEntries)
+        {
+            return nullptr;
+        }
+    }
+
+    io_uring_sqe *entry = &m_submissionEntries[m_submissionTail & m_sqMask];
+    memset(entry, 0, sizeof(*entry));
+    m_submissionTail++;
+
+    return entry;
+}
+
+int URing::Enter(unsigned int toSubmit, unsigned int minCompletions)
+{
+    unsigned int flags = (minCompletions > 0) ? IORING_ENTER_GETEVENTS : 0;
+    int res;
+
+    // Publish the new entries before the kernel is told about them.
+    __atomic_store_n(m_sqTail, m_submissionTail, __ATOMIC_RELEASE);
+
+    res = io_uring_enter(m_descriptor, toSubmit, minCompletions, flags);
+    if (res < 0)
+    {
+        return -errno;
+    }
+
+    m_submittedTail += (uint32_t)res;
+    return res;
+}
+
+int URing::Submit()
+{
+    return Enter(m_submissionTail - m_submittedTail, 0);
+}
+
+int URing::Wait(URingCompletion *o_completions, size_t count, unsigned int minCompletions)
+{
+    uint32_t head;
+    uint32_t tail;
+    size_t reaped = 0;
+
+    if ((m_submissionTail != m_submittedTail) || (minCompletions > 0))
+    {
+        head = *m_cqHead;
+        tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+
+        // Avoid sleeping in the kernel when the completions are already there.
+        unsigned int toWait = (tail - head >= minCompletions) ? 0 : minCompletions;
+        if ((m_submissionTail != m_submittedTail) || (toWait > 0))
+        {
+            int res = Enter(m_submissionTail - m_submittedTail, toWait);
+            if (res < 0)
+            {
+                return res;
+            }
+        }
+    }
+
+    head = *m_cqHead;
+    tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+
+    while ((head != tail) && (reaped < count))
+    {
+        const io_uring_cqe &cqe = m_cqes[head & m_cqMask];
+
+        o_completions[reaped].userData = cqe.user_data;
+        o_completions[reaped].result = cqe.res;
+        o_completions[reaped].flags = cqe.flags;
+
+        reaped++;
+        head++;
+    }
+
+    __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+
+    return (int)reaped;
+}
+
+int URing::PrepareAccept(fd_t descriptor, void *tag, ESubmitFlags flags)
+{
+    io_uring_sqe *entry = GetSubmissionEntry();
+    if (entry == nullptr)
+    {
+        return -EBUSY;
+    }
+
+    entry->opcode = IORING_OP_ACCEPT;
+    entry->fd = descriptor;
+    entry->ioprio = IORING_ACCEPT_MULTISHOT;
+    entry->flags = (uint8_t)flags;
+    entry->user_data = MakeUserData(tag, EURingOperation::Accept);
+
+    return 0;
+}
+
+int URing::PrepareReceive(fd_t descriptor, void *tag, uint16_t groupId, int receiveFlags, ESubmitFlags flags)
+{
+    io_uring_sqe *entry = GetSubmissionEntry();
+    if (entry == nullptr)
+    {
+        return -EBUSY;
+    }
+
+    entry->opcode = IORING_OP_RECV;
+    entry->fd = descriptor;
+    entry->ioprio = IORING_RECV_MULTISHOT;
+    entry->flags = (uint8_t)flags | IOSQE_BUFFER_SELECT;
+    entry->buf_group = groupId;
+    entry->msg_flags = (uint32_t)receiveFlags;
+    entry->user_data = MakeUserData(tag, EURingOperation::Receive);
+
+    return 0;
+}
+
+int URing::PrepareSend(fd_t descriptor, void *tag, const_membuf mem, int sendFlags, ESubmitFlags flags)
+{
+    io_uring_sqe *entry;
+
+    if (mem.buffer == nullptr)
+    {
+        KRAKEN_PRINT("Null parameter (`mem`).");
+        return -EINVAL;
+    }
+
+    entry = GetSubmissionEntry();
+    if (entry == nullptr)
+    {
+        return -EBUSY;
+    }
+
+    entry->opcode = IORING_OP_SEND;
+    entry->fd = descriptor;
+    entry->addr = (uint64_t)(uintptr_t)mem.buffer;
+    entry->len = (uint32_t)mem.length;
+    entry->flags = (uint8_t)flags;
+    entry->msg_flags = (uint32_t)sendFlags;
+    entry->user_data = MakeUserData(tag, EURingOperation::Send);
+
+    return 0;
+}
+
+int URing::PrepareCancel(fd_t descriptor, void *tag)
+{
+    io_uring_sqe *entry = GetSubmissionEntry();
+    if (entry == nullptr)
+    {
+        return -EBUSY;
+    }
+
+    entry->opcode = IORING_OP_ASYNC_CANCEL;
+    entry->fd = descriptor;
+    entry->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+    entry->user_data = MakeUserData(tag, EURingOperation::Cancel);
+
+    return 0;
+}
+
+void URing::Close()
+{
+    // Closing the instance drops its buffer registrations; its descriptor may be reused by another one.
+    while (m_bufferRings != nullptr)
+    {
+        URingBufferRing *bufferRing = m_bufferRings;
+
+        m_bufferRings = bufferRing->m_nextBufferRing;
+        bufferRing->m_owner = nullptr;
+        bufferRing->m_nextBufferRing = nullptr;
+    }
+
+    if (m_submissionEntries != nullptr)
+    {
+        munmap(m_submissionEntries, m_submissionEntriesSize);
+        m_submissionEntries = nullptr;
+    }
+
+    if ((m_completionRing != nullptr) && (m_completionRing != m_submissionRing))
+    {
+        munmap(m_completionRing, m_completionRingSize);
+    }
+    m_completionRing = nullptr;
+
+    if (m_submissionRing != nullptr)
+    {
+        munmap(m_submissionRing, m_submissionRingSize);
+        m_submissionRing = nullptr;
+    }
+
+    if (close(m_descriptor) == 0)
+    {
+        m_descriptor = -EBADFD;
+    }
+}
+
+int URingBufferRing::Open(URing &ring, uint16_t groupId, membuf storage, uint16_t bufferCount)
+{
+    io_uring_buf_reg registration;
+    size_t ringSize = bufferCount * sizeof(io_uring_buf);
+    void *ringMemory;
+    int err;
+
+    if (IsOpen())
+    {
+        return -EBUSY;
+    }
+    else if (!storage.is_valid() || (bufferCount == 0) || ((bufferCount & (bufferCount - 1)) != 0) ||
+             (bufferCount > 32768) || (storage.length < bufferCount))
+    {
+        KRAKEN_PRINT("Invalid buffer ring geometry.");
+        return -EINVAL;
+    }
+
+    // The ring must be page aligned, and populated before the kernel pins it.
+    ringMemory = mmap(nullptr, ringSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (ringMemory == MAP_FAILED)
+    {
+        return -errno;
+    }
+
+    memset(&registration, 0, sizeof(registration));
+    registration.ring_addr = (uint64_t)(uintptr_t)ringMemory;
+    registration.ring_entries = bufferCount;
+    registration.bgid = groupId;
+
+    err = io_uring_register(ring.GetFileDescriptor(), IORING_REGISTER_PBUF_RING, &registration, 1);
+    if (err < 0)
+    {
+        err = -errno;
+        KRAKEN_PRINT("Failed to register buffer ring. errno = %d", err);
+        munmap(ringMemory, ringSize);
+        return err;
+    }
+
+    m_owner = &ring;
+    m_nextBufferRing = ring.m_bufferRings;
+    ring.m_bufferRings = this;
+    m_ring = (io_uring_buf *)ringMemory;
+    m_storage = (uint8_t *)storage.buffer;
+    m_bufferSize = storage.length / bufferCount;
+    m_bufferCount = bufferCount;
+    m_groupId = groupId;
+    m_tail = 0;
+
+    for (uint16_t bufferId = 0; bufferId < bufferCount; bufferId++)
+    {
+        Provide(bufferId);
+    }
+    __atomic_store_n(GetTailPointer(), m_tail, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+membuf URingBufferRing::GetBuffer(const URingCompletion &completion) const
+{
+    size_t length = (completion.result > 0) ? (size_t)completion.result : 0;
+    return membuf(m_storage + completion.GetBufferId() * m_bufferSize, length);
+}
+
+void URingBufferRing::Provide(uint16_t bufferId)
+{
+    io_uring_buf &slot = m_ring[m_tail & (m_bufferCount - 1)];
+
+    slot.addr = (uint64_t)(uintptr_t)(m_storage + bufferId * m_bufferSize);
+    slot.len = (uint32_t)m_bufferSize;
+    slot.bid = bufferId;
+
+    m_tail++;
+}
+
+void URingBufferRing::Recycle(uint16_t bufferId)
+{
+    Provide(bufferId);
+    __atomic_store_n(GetTailPointer(), m_tail, __ATOMIC_RELEASE);
+}
+
+void URingBufferRing::Close()
+{
+    io_uring_buf_reg registration;
+
+    if (m_owner != nullptr)
+    {
+        memset(&registration, 0, sizeof(registration));
+        registration.bgid = m_groupId;
+
+        io_uring_register(m_owner->GetFileDescriptor(), IORING_UNREGISTER_PBUF_RING, &registration, 1);
+
+        URingBufferRing **link = &m_owner->m_bufferRings;
+        while (*link != this)
+        {
+            link = &(*link)->m_nextBufferRing;
+        }
+
+        *link = m_nextBufferRing;
+        m_owner = nullptr;
+        m_nextBufferRing = nullptr;
+    }
+
+    munmap(m_ring, m_bufferCount * sizeof(io_uring_buf));
+    m_ring = nullptr;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file buffered_stream_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/BufferedStream.h>
+#include <Kraken/IO/File.h>
+#include <Kraken/Collections.h>
+
+using namespace Kraken;
+
+/**
+ * A stream that counts the calls made to it.
+ */
+class CountingStream : public IStream
+{
+public:
+    using IStream::Read;
+    using IStream::Write;
+
+    CountingStream(IStream &inner) : reads(0), writes(0), m_inner(inner) {}
+
+    ssize_t Read(void *o_buffer, size_t length) override
+    {
+        reads++;
+        return m_inner.Read(o_buffer, length);
+    }
+
+    ssize_t Write(const void *buffer, size_t length) override
+    {
+        writes++;
+        return m_inner.Write(buffer, length);
+    }
+
+    size_t reads;
+    size_t writes;
+
+private:
+    IStream &m_inner;
+};
+
+TEST(BufferedStreamTests, CoalescedWrites)
+{
+    File readEnd, writeEnd;
+    buffer<20> message(1);
+    buffer<200> output;
+
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+    CountingStream counter(writeEnd);
+
+    {
+        BufferedWriter<128> writer(counter);
+
+        for (size_t index = 0; index < 10; index++)
+        {
+            ASSERT_EQ(writer.Write(message), sizeof(message));
+        }
+
+        // 6 messages fit in the buffer; the 7th flushed them.
+        ASSERT_EQ(counter.writes, 1);
+        ASSERT_EQ(writer.GetBufferedLength(), 4 * sizeof(message));
+        ASSERT_EQ(writer.Flush(), 0);
+        ASSERT_EQ(writer.GetBufferedLength(), 0);
+        ASSERT_EQ(counter.writes, 2);
+    }
+
+    ASSERT_EQ(readEnd.Read(output), sizeof(output));
+}
+
+TEST(BufferedStreamTests, LargeWriteBypass)
+{
+    File readEnd, writeEnd;
+    buffer<8> small(1);
+    buffer<64> large(2);
+    buffer<72> output;
+
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+    CountingStream counter(writeEnd);
+    BufferedWriter<32> writer(counter);
+
+    ASSERT_EQ(writer.Write(small), sizeof(small));
+    ASSERT_EQ(writer.Write(large), sizeof(large));
+    ASSERT_EQ(counter.writes, 2);
+    ASSERT_EQ(writer.GetBufferedLength(), 0);
+
+    ASSERT_EQ(readEnd.Read(output), sizeof(output));
+    ASSERT_EQ(output[7], 1);
+    ASSERT_EQ(output[8], 2);
+}
+
+TEST(BufferedStreamTests, PeekConsume)
+{
+    const char input[] = "abcdef";
+    File readEnd, writeEnd;
+    char output[4] = {0};
+
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+    ASSERT_EQ(writeEnd.Write(input, 6), 6);
+
+    BufferedReader<16> reader(readEnd);
+    ASSERT_EQ(reader.Peek().length, 0);
+    ASSERT_EQ(reader.Fill(), 6);
+
+    const_membuf view = reader.Peek();
+    ASSERT_EQ(view.length, 6);
+    ASSERT_EQ(memcmp(view.buffer, input, 6), 0);
+
+    reader.Consume(2);
+    ASSERT_EQ(reader.Read(output, 3), 3);
+    ASSERT_EQ(memcmp(output, "cde", 3), 0);
+    ASSERT_EQ(reader.GetBufferedLength(), 1);
+}
+
+TEST(BufferedStreamTests, ReadUntil)
+{
+    const char input[] = "first\nsecond line\nlast";
+    File readEnd, writeEnd;
+    char line[32];
+
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+    ASSERT_EQ(writeEnd.Write(input, strlen(input)), strlen(input));
+    writeEnd.Close();
+
+    CountingStream counter(readEnd);
+    BufferedReader<8> reader(counter);
+
+    ASSERT_EQ(reader.ReadUntil('\n', line), 6);
+    ASSERT_EQ(memcmp(line, "first\n", 6), 0);
+
+    ASSERT_EQ(reader.ReadUntil('\n', line), 12);
+    ASSERT_EQ(memcmp(line, "second line\n", 12), 0);
+
+    // The stream ends before the delimiter.
+    ASSERT_EQ(reader.ReadUntil('\n', line), 4);
+    ASSERT_EQ(memcmp(line, "last", 4), 0);
+    ASSERT_EQ(reader.ReadUntil('\n', line), 0);
+
+    // Far fewer reads than bytes.
+    ASSERT_LE(counter.reads, 5);
+}
+
+TEST(BufferedStreamTests, ReadUntilShortBuffer)
+{
+    const char input[] = "0123456789\n";
+    File readEnd, writeEnd;
+    char part[4];
+
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+    ASSERT_EQ(writeEnd.Write(input, strlen(input)), strlen(input));
+
+    BufferedReader<64> reader(readEnd);
+
+    // The record does not fit; the caller sees the last byte is not the delimiter and continues.
+    ASSERT_EQ(reader.ReadUntil('\n', part), 4);
+    ASSERT_EQ(memcmp(part, "0123", 4), 0);
+    ASSERT_EQ(reader.ReadUntil('\n', part), 4);
+    ASSERT_EQ(reader.ReadUntil('\n', part), 3);
+    ASSERT_EQ(memcmp(part, "89\n", 3), 0);
+}
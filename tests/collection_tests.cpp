@@ -139,4 +139,20 @@ TEST(CollectionTests, ArrayQueue)
     ASSERT_TRUE(q0.Push(c));
     ASSERT_TRUE(q0.Push(d));
     ASSERT_TRUE(q0.Push(e));
-}
\ No newline at end of file
+}
+
+TEST(CollectionTests, AlignedBuffer)
+{
+    aligned_buffer<512, 512> a(3);
+    aligned_buffer<100, 64> b;
+    membuf mem = a;
+
+    ASSERT_EQ((uintptr_t)&a[0] % 512, 0);
+    ASSERT_EQ((uintptr_t)&b[0] % 64, 0);
+    ASSERT_EQ(a.length(), 512);
+    ASSERT_EQ(a.alignment(), 512);
+
+    ASSERT_EQ(mem.buffer, &a[0]);
+    ASSERT_EQ(mem.length, 512);
+    ASSERT_EQ(a[511], 3);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file directory_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/Directory.h>
+#include <Kraken/Collections.h>
+
+using namespace Kraken;
+
+TEST(DirectoryTests, ScanAndRemove)
+{
+    const size_t fileCount = 200;
+    char path[] = "/tmp/kraken-dir-XXXXXX";
+    char name[16];
+    buffer<1024> entriesBuffer;
+    Directory directory;
+    DirectoryEntries entries;
+    bool seen[fileCount] = {false};
+    size_t found = 0;
+    ssize_t res;
+
+    ASSERT_NE(mkdtemp(path), nullptr);
+    ASSERT_EQ(directory.Open(path), 0);
+    ASSERT_EQ(directory.Open(path), -EBUSY);
+
+    for (size_t index = 0; index < fileCount; index++)
+    {
+        File child;
+        snprintf(name, sizeof(name), "spool-%zu", index);
+        ASSERT_EQ(directory.OpenChild(child, name, EFileFlags::Write | EFileFlags::Create), 0);
+    }
+    ASSERT_EQ(mkdirat(directory.GetFileDescriptor(), "nested", 0700), 0);
+
+    // A small buffer takes several batches.
+    while ((res = directory.ReadEntries(entriesBuffer, entries)) > 0)
+    {
+        for (DirectoryEntry entry : entries)
+        {
+            size_t index;
+
+            if (entry.IsSelfOrParent())
+            {
+                continue;
+            }
+
+            ASSERT_NE(entry.GetInode(), 0);
+
+            if (strcmp(entry.GetName(), "nested") == 0)
+            {
+                ASSERT_TRUE((entry.GetType() == EEntryType::Directory) || (entry.GetType() == EEntryType::Unknown));
+                ASSERT_EQ(directory.RemoveChild(entry.GetName(), true), 0);
+                continue;
+            }
+
+            ASSERT_EQ(sscanf(entry.GetName(), "spool-%zu", &index), 1);
+            ASSERT_LT(index, fileCount);
+            ASSERT_FALSE(seen[index]);
+            seen[index] = true;
+            found++;
+
+            ASSERT_EQ(directory.RemoveChild(entry.GetName()), 0);
+        }
+    }
+    ASSERT_EQ(res, 0);
+    ASSERT_EQ(found, fileCount);
+
+    ASSERT_EQ(directory.Rewind(), 0);
+    while ((res = directory.ReadEntries(entriesBuffer, entries)) > 0)
+    {
+        for (DirectoryEntry entry : entries)
+        {
+            ASSERT_TRUE(entry.IsSelfOrParent());
+        }
+    }
+    ASSERT_EQ(res, 0);
+
+    ASSERT_EQ(directory.RemoveChild("missing"), -ENOENT);
+    ASSERT_EQ(rmdir(path), 0);
+}
+
+TEST(DirectoryTests, ResolveFlags)
+{
+    char path[] = "/tmp/kraken-dir-XXXXXX";
+    Directory directory;
+    File child;
+
+    ASSERT_NE(mkdtemp(path), nullptr);
+    ASSERT_EQ(directory.Open(path), 0);
+    ASSERT_EQ(symlinkat("/etc/hostname", directory.GetFileDescriptor(), "link"), 0);
+
+    int err = directory.OpenChild(child, "spool", EFileFlags::Write | EFileFlags::Create, EResolveFlags::Beneath);
+    if (err == -ENOSYS)
+    {
+        GTEST_SKIP() << "openat2 is unavailable";
+    }
+    ASSERT_EQ(err, 0);
+    child.Close();
+
+    ASSERT_EQ(directory.OpenChild(child, "../spool", EFileFlags::Read, EResolveFlags::Beneath), -EXDEV);
+    ASSERT_EQ(directory.OpenChild(child, "link", EFileFlags::Read, EResolveFlags::NoSymbolicLinks), -ELOOP);
+    ASSERT_EQ(directory.OpenChild(child, "link", EFileFlags::Read, EResolveFlags::Beneath), -EXDEV);
+
+    // The entry was just created, so its resolution is cached.
+    err = directory.OpenChild(child, "spool", EFileFlags::Read, EResolveFlags::Cached);
+    ASSERT_TRUE((err == 0) || (err == -EAGAIN));
+    child.Close();
+
+    ASSERT_EQ(directory.RemoveChild("spool"), 0);
+    ASSERT_EQ(directory.RemoveChild("link"), 0);
+    ASSERT_EQ(rmdir(path), 0);
+}
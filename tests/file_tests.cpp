@@ -79,4 +79,214 @@ TEST(FileTests, OffsetIO)
     temp.ReadAt(buf, 64 + sizeof(bigSample) / 2);
 
     ASSERT_EQ(memcmp(buf, expected.buffer, expected.length), 0);
-}
\ No newline at end of file
+}
+
+TEST(FileTests, DirectIO)
+{
+    static constexpr auto path = "kraken_direct_test.bin";
+    aligned_buffer<8192> out(7);
+    aligned_buffer<8192> in(0);
+    size_t blockSize = 0;
+    File f;
+
+    int err = f.Open(path, EFileFlags::ReadWrite | EFileFlags::Create | EFileFlags::Truncate | EFileFlags::Direct);
+    if (err == -EINVAL)
+    {
+        GTEST_SKIP() << "Direct IO is not supported by the file system";
+    }
+    ASSERT_EQ(err, 0);
+    unlink(path);
+
+    ASSERT_EQ(f.GetLogicalBlockSize(blockSize), 0);
+    ASSERT_GT(blockSize, 0);
+    ASSERT_EQ(sizeof(out) % blockSize, 0);
+
+    ASSERT_EQ(f.WriteAt(out, 0), sizeof(out));
+    ASSERT_EQ(f.ReadAt(in, 0), sizeof(in));
+    ASSERT_EQ(memcmp(in, out, sizeof(in)), 0);
+
+#ifndef NDEBUG
+    ASSERT_EQ(f.WriteAt(&out[1], blockSize, 0), -EINVAL);
+    ASSERT_EQ(f.ReadAt(in, 1), -EINVAL);
+#endif
+
+    // The cached direct IO state doesn't outlive the descriptor, even if its number is reused.
+    f.Close();
+    ASSERT_EQ(f.Open(path, EFileFlags::ReadWrite | EFileFlags::Create | EFileFlags::Truncate), 0);
+    unlink(path);
+    ASSERT_EQ(f.WriteAt(&out[1], 3, 1), 3);
+
+    // Direct IO can be toggled on an open descriptor.
+    ASSERT_EQ(fcntl(f.GetFileDescriptor(), F_SETFL, O_DIRECT), 0);
+#ifndef NDEBUG
+    ASSERT_EQ(f.WriteAt(&out[1], blockSize, 0), -EINVAL);
+#endif
+    ASSERT_EQ(f.WriteAt(out, blockSize, 0), blockSize);
+    ASSERT_EQ(fcntl(f.GetFileDescriptor(), F_SETFL, 0), 0);
+    ASSERT_EQ(f.WriteAt(&out[1], 3, 1), 3);
+}
+
+TEST(FileTests, RWFlags)
+{
+    File temp(fileno(tmpfile()));
+    uint8_t sample[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint8_t tail[] = {8, 9};
+    uint8_t buf[10] = {0};
+    membuf vectors[] = {membuf(buf, 4), membuf(buf + 4, 6)};
+
+    ASSERT_EQ(temp.WriteAt(sample, sizeof(sample), 0, ERWFlags::DataSync), sizeof(sample));
+
+    // The offset is ignored when appending.
+    ASSERT_EQ(temp.WriteAt(tail, 0, ERWFlags::Append), sizeof(tail));
+
+    // Freshly written data is in the page cache, so a non-blocking read succeeds.
+    ASSERT_EQ(temp.Read(vectors, 0, ERWFlags::NoWait), sizeof(buf));
+    for (uint8_t index = 0; index < sizeof(buf); index++)
+    {
+        ASSERT_EQ(buf[index], index);
+    }
+
+    ASSERT_EQ(temp.ReadAt(buf, 2, ERWFlags::None), 8);
+    ASSERT_EQ(buf[0], 2);
+}
+
+TEST(FileTests, Allocate)
+{
+    File temp(fileno(tmpfile()));
+    struct stat info;
+
+    ASSERT_EQ(temp.Allocate(0, 1 << 16), 0);
+    ASSERT_EQ(fstat(temp.GetFileDescriptor(), &info), 0);
+    ASSERT_EQ(info.st_size, 1 << 16);
+
+    // Preallocate past the end without changing the size.
+    ASSERT_EQ(temp.Allocate(1 << 16, 1 << 16, EAllocateFlags::KeepSize), 0);
+    ASSERT_EQ(fstat(temp.GetFileDescriptor(), &info), 0);
+    ASSERT_EQ(info.st_size, 1 << 16);
+
+    ASSERT_EQ(temp.Allocate(0, 4096, EAllocateFlags::PunchHole), -EOPNOTSUPP);
+    ASSERT_EQ(temp.Allocate(0, 4096, EAllocateFlags::PunchHole | EAllocateFlags::KeepSize), 0);
+}
+
+TEST(FileTests, CacheControl)
+{
+    File temp(fileno(tmpfile()));
+    uint8_t data[4096] = {0};
+
+    ASSERT_EQ(temp.Write(data), sizeof(data));
+    ASSERT_EQ(temp.SyncRange(0, 0, ESyncRangeFlags::Write | ESyncRangeFlags::WaitAfter), 0);
+    ASSERT_EQ(temp.DataSync(), 0);
+    ASSERT_EQ(temp.Sync(), 0);
+
+    ASSERT_EQ(temp.Advise(EAdvice::Sequential), 0);
+    ASSERT_EQ(temp.Readahead(0, sizeof(data)), 0);
+    ASSERT_EQ(temp.Advise(EAdvice::DontNeed, 0, sizeof(data)), 0);
+
+    File pipeRead, pipeWrite;
+    ASSERT_EQ(File::Pipe(pipeRead, pipeWrite), 0);
+    ASSERT_EQ(pipeRead.Advise(EAdvice::Random), -ESPIPE);
+}
+
+TEST(FileTests, PublishTemporary)
+{
+    const char path[] = "/tmp/kraken-publish-test";
+    const uint8_t first[4] = {1, 2, 3, 4};
+    const uint8_t second[4] = {5, 6, 7, 8};
+    uint8_t data[4];
+    File reader;
+
+    unlink(path);
+
+    {
+        File temp;
+        ASSERT_EQ(temp.OpenTemporary("/tmp"), 0);
+        ASSERT_EQ(temp.OpenTemporary("/tmp"), -EBUSY);
+        ASSERT_EQ(temp.Write(first), sizeof(first));
+        ASSERT_EQ(temp.Publish(path, true), 0);
+    }
+
+    // Replace the published file while it is still open.
+    ASSERT_EQ(reader.Open(path, EFileFlags::Read), 0);
+
+    {
+        File temp;
+        ASSERT_EQ(temp.OpenTemporary("/tmp"), 0);
+        ASSERT_EQ(temp.Write(second), sizeof(second));
+        ASSERT_EQ(temp.Publish(path), 0);
+    }
+
+    ASSERT_EQ(reader.ReadAt(data, sizeof(data), 0), sizeof(data));
+    ASSERT_EQ(memcmp(data, first, sizeof(first)), 0);
+    reader.Close();
+
+    ASSERT_EQ(reader.Open(path, EFileFlags::Read), 0);
+    ASSERT_EQ(reader.Read(data), sizeof(data));
+    ASSERT_EQ(memcmp(data, second, sizeof(second)), 0);
+    reader.Close();
+
+    ASSERT_EQ(unlink(path), 0);
+}
+
+TEST(FileTests, PublishNamed)
+{
+    const char source[] = "/tmp/kraken-publish-source";
+    const char path[] = "/tmp/kraken-publish-named";
+    File temp;
+    struct stat info;
+
+    ASSERT_EQ(temp.Open(source, EFileFlags::Write | EFileFlags::Create | EFileFlags::Truncate), 0);
+    ASSERT_EQ(temp.Publish(path, true), 0);
+
+    ASSERT_EQ(stat(source, &info), -1);
+    ASSERT_EQ(stat(path, &info), 0);
+    ASSERT_EQ(unlink(path), 0);
+}
+
+TEST(FileTests, PipeCapacity)
+{
+    File a, b;
+    size_t capacity;
+
+    ASSERT_EQ(File::Pipe(a, b), 0);
+    ASSERT_EQ(a.GetPipeCapacity(capacity), 0);
+    ASSERT_EQ(capacity, 65536);
+
+    ASSERT_EQ(b.SetPipeCapacity(1 << 18), 0);
+    ASSERT_EQ(a.GetPipeCapacity(capacity), 0);
+    ASSERT_EQ(capacity, 1 << 18);
+
+    // Rounded up to a power-of-two number of pages.
+    ASSERT_EQ(b.SetPipeCapacity(5000), 0);
+    ASSERT_EQ(b.GetPipeCapacity(capacity), 0);
+    ASSERT_EQ(capacity, 8192);
+
+    File temp(fileno(tmpfile()));
+    ASSERT_EQ(temp.GetPipeCapacity(capacity), -EBADF);
+}
+
+TEST(FileTests, Splice)
+{
+    uint8_t data[4096];
+    uint8_t output[4096];
+    File input(fileno(tmpfile())), result(fileno(tmpfile()));
+    File readEnd, writeEnd;
+    size_t pending;
+
+    for (size_t index = 0; index < sizeof(data); index++)
+    {
+        data[index] = (uint8_t)index;
+    }
+
+    ASSERT_EQ(input.WriteAt(data, sizeof(data), 0), sizeof(data));
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+
+    ASSERT_EQ(File::Splice(input, writeEnd, sizeof(data), ESpliceFlags::Move), sizeof(data));
+    ASSERT_EQ(readEnd.GetPendingLength(pending), 0);
+    ASSERT_EQ(pending, sizeof(data));
+
+    ASSERT_EQ(File::Splice(readEnd, result, sizeof(data)), sizeof(data));
+    ASSERT_EQ(File::Splice(readEnd, result, sizeof(data), ESpliceFlags::NonBlock), -EAGAIN);
+
+    ASSERT_EQ(result.ReadAt(output, sizeof(output), 0), sizeof(output));
+    ASSERT_EQ(memcmp(output, data, sizeof(data)), 0);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file inotify_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/INotify.h>
+#include <Kraken/IO/EPoll.h>
+#include <Kraken/IO/File.h>
+#include <Kraken/Collections.h>
+
+using namespace Kraken;
+
+TEST(INotifyTests, Initialization)
+{
+    INotify notify;
+    int watch;
+
+    ASSERT_FALSE(notify.IsOpen());
+    ASSERT_EQ(notify.Open(), 0);
+    ASSERT_TRUE(notify.IsOpen());
+    ASSERT_EQ(notify.Open(), -EBUSY);
+
+    ASSERT_EQ(notify.AddWatch("/nonexistent-kraken-path", EINotifyEvents::All, watch), -ENOENT);
+    ASSERT_EQ(notify.AddWatch("/tmp", EINotifyEvents::Create | EINotifyEvents::OnlyDirectory, watch), 0);
+    ASSERT_EQ(notify.RemoveWatch(watch), 0);
+    ASSERT_EQ(notify.RemoveWatch(watch), -EINVAL);
+}
+
+TEST(INotifyTests, DirectoryEvents)
+{
+    char path[] = "/tmp/kraken-inotify-XXXXXX";
+    char filePath[64], movedPath[64];
+    buffer<INotify::s_MinimalBufferSize * 4> eventsBuffer;
+    INotify notify;
+    INotifyEvents events;
+    EPoll<> epoll;
+    IEPollable *ready[1] = {nullptr};
+    int watch;
+
+    ASSERT_NE(mkdtemp(path), nullptr);
+    snprintf(filePath, sizeof(filePath), "%s/config", path);
+    snprintf(movedPath, sizeof(movedPath), "%s/config.old", path);
+
+    ASSERT_EQ(notify.Open(EINotifyFlags::NonBlock | EINotifyFlags::CloseOnExec), 0);
+    ASSERT_EQ(notify.AddWatch(path, EINotifyEvents::Create | EINotifyEvents::Move | EINotifyEvents::Delete, watch), 0);
+    ASSERT_EQ(notify.ReadEvents(eventsBuffer, events), -EAGAIN);
+
+    ASSERT_EQ(epoll.Open(), 0);
+    ASSERT_EQ(epoll.AddWatch(notify), 0);
+    ASSERT_EQ(epoll.Wait(ready, 0), 0);
+
+    {
+        File file;
+        ASSERT_EQ(file.Open(filePath, EFileFlags::Write | EFileFlags::Create), 0);
+    }
+    ASSERT_EQ(rename(filePath, movedPath), 0);
+    ASSERT_EQ(unlink(movedPath), 0);
+
+    ASSERT_EQ(epoll.Wait(ready, 1000), 1);
+    ASSERT_EQ(ready[0], &notify);
+
+    EINotifyEvents expected[4] = {EINotifyEvents::Create, EINotifyEvents::MovedFrom,
+                                  EINotifyEvents::MovedTo, EINotifyEvents::Delete};
+    const char *expectedNames[4] = {"config", "config", "config.old", "config.old"};
+    uint32_t cookie = 0;
+    size_t count = 0;
+
+    while (count < 4)
+    {
+        ASSERT_GT(notify.ReadEvents(eventsBuffer, events), 0);
+
+        for (INotifyEvent event : events)
+        {
+            ASSERT_LT(count, 4);
+            ASSERT_EQ(event.GetWatch(), watch);
+            ASSERT_EQ(event.GetEvents(), expected[count]);
+            ASSERT_TRUE(event.HasName());
+            ASSERT_STREQ(event.GetName(), expectedNames[count]);
+
+            if (event.Is(EINotifyEvents::Move))
+            {
+                ASSERT_NE(event.GetCookie(), 0);
+                cookie = (cookie == 0) ? event.GetCookie() : cookie;
+                ASSERT_EQ(event.GetCookie(), cookie);
+            }
+
+            count++;
+        }
+    }
+
+    ASSERT_EQ(rmdir(path), 0);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file listener_group_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/ListenerGroup.h>
+#include <sys/resource.h>
+#include <time.h>
+
+using namespace Kraken;
+
+struct AcceptCounters
+{
+    size_t total;
+    size_t perShard[4];
+    size_t pinned;
+};
+
+static void CountConnection(void *context, size_t shard, fd_t client)
+{
+    AcceptCounters *counters = (AcceptCounters *)context;
+    IPv4Socket socket(client);
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t set;
+
+    if ((pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) && (CPU_COUNT(&set) == 1) &&
+        CPU_ISSET(shard % (size_t)cpus, &set))
+    {
+        __atomic_add_fetch(&counters->pinned, 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_add_fetch(&counters->perShard[shard], 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&counters->total, 1, __ATOMIC_RELEASE);
+}
+
+static void WaitForConnections(AcceptCounters &counters, size_t expected)
+{
+    for (int attempt = 0; (attempt < 2000) && (__atomic_load_n(&counters.total, __ATOMIC_ACQUIRE) < expected); attempt++)
+    {
+        usleep(1000);
+    }
+}
+
+TEST(ListenerGroupTests, AcceptAcrossShards)
+{
+    ListenerGroup<ESocketDomain::IPv4, 4> group;
+    const IPv4Address address("127.0.0.1", 0x6680);
+    AcceptCounters counters = {0, {0}};
+    IPv4Socket clients[16];
+
+    ASSERT_EQ(group.Open(address, 16), 0);
+    ASSERT_EQ(group.Open(address, 16), -EBUSY);
+    ASSERT_EQ(group.Start(CountConnection, &counters), 0);
+    ASSERT_EQ(group.Start(CountConnection, &counters), -EBUSY);
+
+    for (auto &client : clients)
+    {
+        ASSERT_EQ(client.Open(ESocketType::Stream), 0);
+        ASSERT_EQ(client.Connect(address), 0);
+    }
+
+    WaitForConnections(counters, 16);
+    group.Stop();
+
+    ASSERT_EQ(counters.total, 16);
+    ASSERT_EQ(counters.perShard[0] + counters.perShard[1] + counters.perShard[2] + counters.perShard[3], 16);
+
+    // Shards are pinned from the start.
+    ASSERT_EQ(counters.pinned, 16);
+
+    // Stopped shards leave new connections queued, until they are started again.
+    IPv4Socket late;
+    ASSERT_EQ(late.Open(ESocketType::Stream), 0);
+    ASSERT_EQ(late.Connect(address), 0);
+
+    ASSERT_EQ(group.Start(CountConnection, &counters), 0);
+    WaitForConnections(counters, 17);
+    ASSERT_EQ(counters.total, 17);
+
+    group.Close();
+}
+
+TEST(ListenerGroupTests, HashSteering)
+{
+    ListenerGroup<ESocketDomain::IPv4, 2> group;
+    const IPv4Address address("127.0.0.1", 0x6681);
+    AcceptCounters counters = {0, {0}};
+    IPv4Socket client;
+
+    ASSERT_EQ(group.Open(address, 4, EListenerGroupFlags::None), 0);
+    ASSERT_EQ(group.Start(CountConnection, &counters), 0);
+
+    ASSERT_EQ(client.Open(ESocketType::Stream), 0);
+    ASSERT_EQ(client.Connect(address), 0);
+
+    WaitForConnections(counters, 1);
+    ASSERT_EQ(counters.total, 1);
+}
+
+TEST(ListenerGroupTests, CpuSteering)
+{
+    ListenerGroup<ESocketDomain::IPv4, 1> group;
+    ListenerGroup<ESocketDomain::IPv4, 2> oversized;
+    const IPv4Address address("127.0.0.1", 0x6682);
+    AcceptCounters counters = {0, {0}};
+    IPv4Socket client;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    // CPU steering needs a shard per CPU.
+    ASSERT_EQ(oversized.Open(address, 4, EListenerGroupFlags::CpuSteering), (cpus == 2) ? 0 : -EINVAL);
+    oversized.Close();
+
+    if (cpus != 1)
+    {
+        GTEST_SKIP() << "Steering is only exercised on a single CPU";
+    }
+
+    ASSERT_EQ(group.Open(address, 4, EListenerGroupFlags::PinThreads | EListenerGroupFlags::CpuSteering), 0);
+    ASSERT_EQ(group.Start(CountConnection, &counters), 0);
+
+    ASSERT_EQ(client.Open(ESocketType::Stream), 0);
+    ASSERT_EQ(client.Connect(address), 0);
+
+    WaitForConnections(counters, 1);
+    ASSERT_EQ(counters.perShard[0], 1);
+}
+
+TEST(ListenerGroupTests, DescriptorExhaustion)
+{
+    ListenerGroup<ESocketDomain::IPv4, 1> group;
+    const IPv4Address address("127.0.0.1", 0x6683);
+    AcceptCounters counters = {0, {0}};
+    IPv4Socket client;
+    struct rlimit original, exhausted;
+    struct timespec before, after;
+
+    ASSERT_EQ(group.Open(address, 4, EListenerGroupFlags::None), 0);
+    ASSERT_EQ(group.Start(CountConnection, &counters), 0);
+    ASSERT_EQ(client.Open(ESocketType::Stream), 0);
+
+    // Leave no room for the accepted descriptor.
+    fd_t next = dup(0);
+    ASSERT_GE(next, 0);
+    close(next);
+
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &original), 0);
+    exhausted = original;
+    exhausted.rlim_cur = (rlim_t)next;
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &exhausted), 0);
+
+    ASSERT_EQ(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &before), 0);
+    ASSERT_EQ(client.Connect(address), 0);
+    usleep(300000);
+    ASSERT_EQ(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &after), 0);
+
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &original), 0);
+
+    // The shard backs off instead of spinning on the readable listener.
+    uint64_t spentMicros = (uint64_t)(after.tv_sec - before.tv_sec) * 1000000 + (after.tv_nsec - before.tv_nsec) / 1000;
+    ASSERT_LT(spentMicros, 100000u);
+    ASSERT_EQ(__atomic_load_n(&counters.total, __ATOMIC_ACQUIRE), 0);
+
+    // Once descriptors are available again, the connection is accepted.
+    WaitForConnections(counters, 1);
+    ASSERT_EQ(counters.total, 1);
+}
@@ -0,0 +1,309 @@
+/**
+ * @file log_writer_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/LogWriter.h>
+#include <Kraken/Checksum.h>
+#include <Kraken/Collections.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+
+using namespace Kraken;
+
+/**
+ * A temporary log directory, removed with its segments at the end of the test.
+ */
+struct TemporaryLogDirectory
+{
+    char path[32];
+
+    TemporaryLogDirectory()
+    {
+        strcpy(path, "/tmp/kraken-log-XXXXXX");
+        mkdtemp(path);
+    }
+
+    ~TemporaryLogDirectory()
+    {
+        DIR *listing = opendir(path);
+        struct dirent *entry;
+
+        while ((listing != nullptr) && ((entry = readdir(listing)) != nullptr))
+        {
+            if (entry->d_name[0] != '.')
+            {
+                unlinkat(dirfd(listing), entry->d_name, 0);
+            }
+        }
+
+        closedir(listing);
+        rmdir(path);
+    }
+
+    void SegmentPath(char (&o_path)[64], uint64_t index)
+    {
+        snprintf(o_path, sizeof(o_path), "%s/%020lu.log", path, (unsigned long)index);
+    }
+};
+
+TEST(ChecksumTests, Crc32c)
+{
+    const char digits[] = "123456789";
+
+    ASSERT_EQ(Crc32c(digits, 9), 0xe3069283u);
+    ASSERT_EQ(Crc32c(digits + 4, 5, Crc32c(digits, 4)), 0xe3069283u);
+    ASSERT_EQ(Crc32c(digits, 0), 0u);
+}
+
+TEST(LogWriterTests, AppendScan)
+{
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    LogScanner scanner;
+    uint32_t record;
+
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), -EBADF);
+    ASSERT_EQ(writer.Open(directory.path, 1 << 20), 0);
+    ASSERT_EQ(writer.Open(directory.path, 1 << 20), -EBUSY);
+
+    for (record = 0; record < 100; record++)
+    {
+        ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+    }
+    ASSERT_EQ(writer.Append(nullptr, 0, ELogAppendFlags::Sync), 0);
+    writer.Close();
+
+    ASSERT_EQ(scanner.Open(directory.path), 0);
+    for (uint32_t expected = 0; expected < 100; expected++)
+    {
+        ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), sizeof(record));
+        ASSERT_EQ(record, expected);
+    }
+    ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), 0);
+    ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), 0);
+    ASSERT_FALSE(scanner.IsTornTail());
+}
+
+TEST(LogWriterTests, SegmentRolling)
+{
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    LogScanner scanner;
+    buffer<20> record(0);
+    buffer<2> small;
+
+    // Each segment holds two records.
+    ASSERT_EQ(writer.Open(directory.path, 2 * (sizeof(LogRecordHeader) + sizeof(record)), 1 << 20), 0);
+
+    for (size_t index = 0; index < 9; index++)
+    {
+        record[0] = (unsigned char)index;
+        ASSERT_EQ(writer.Append(record), 0);
+    }
+    ASSERT_EQ(writer.GetSegmentIndex(), 4);
+    writer.Close();
+
+    ASSERT_EQ(scanner.Open(directory.path), 0);
+    ASSERT_EQ(scanner.Next(small), -EMSGSIZE);
+
+    for (size_t index = 0; index < 9; index++)
+    {
+        ASSERT_EQ(scanner.Next(record), sizeof(record));
+        ASSERT_EQ(record[0], index);
+        ASSERT_EQ(scanner.GetSegmentIndex(), index / 2);
+    }
+    ASSERT_EQ(scanner.Next(record), 0);
+}
+
+TEST(LogWriterTests, TornTail)
+{
+    const unsigned char garbage[6] = {0xff, 0xff, 0, 0, 1, 2};
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    uint32_t record = 7;
+    char path[64];
+
+    ASSERT_EQ(writer.Open(directory.path, 1 << 20), 0);
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+    writer.Close();
+
+    // Simulate a crash midway through a record.
+    File segment;
+    directory.SegmentPath(path, 0);
+    ASSERT_EQ(segment.Open(path, EFileFlags::Write | EFileFlags::Append), 0);
+    ASSERT_EQ(segment.Write(garbage), sizeof(garbage));
+    segment.Close();
+
+    {
+        LogScanner scanner;
+        ASSERT_EQ(scanner.Open(directory.path), 0);
+        ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), sizeof(record));
+        ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), 0);
+        ASSERT_TRUE(scanner.IsTornTail());
+    }
+
+    // Reopening discards the torn record and resumes the segment.
+    record = 8;
+    ASSERT_EQ(writer.Open(directory.path, 1 << 20), 0);
+    ASSERT_EQ(writer.GetSegmentIndex(), 0);
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+    writer.Close();
+
+    {
+        LogScanner scanner;
+        ASSERT_EQ(scanner.Open(directory.path), 0);
+        ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), sizeof(record));
+        ASSERT_EQ(record, 7);
+        ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), sizeof(record));
+        ASSERT_EQ(record, 8);
+        ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), 0);
+        ASSERT_FALSE(scanner.IsTornTail());
+    }
+}
+
+TEST(LogWriterTests, TornLength)
+{
+    const uint32_t garbage[2] = {0xFFFFFFFF, 0};
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    LogScanner scanner;
+    uint32_t record = 7;
+    uint32_t large[4] = {};
+    char path[64];
+
+    ASSERT_EQ(writer.Open(directory.path, 1 << 20), 0);
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+    ASSERT_EQ(writer.Append(large, sizeof(large)), 0);
+    writer.Close();
+
+    // A crash that left a complete header with a garbage length.
+    File segment;
+    directory.SegmentPath(path, 0);
+    ASSERT_EQ(segment.Open(path, EFileFlags::Write | EFileFlags::Append), 0);
+    ASSERT_EQ(segment.Write(garbage), sizeof(garbage));
+    segment.Close();
+
+    ASSERT_EQ(scanner.Open(directory.path), 0);
+    ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), sizeof(record));
+
+    // An intact record that doesn't fit can be retried with a larger buffer.
+    ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), -EMSGSIZE);
+    ASSERT_EQ(scanner.Next(membuf(large, sizeof(large))), sizeof(large));
+
+    ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), 0);
+    ASSERT_TRUE(scanner.IsTornTail());
+}
+
+TEST(LogWriterTests, CorruptedSegment)
+{
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    LogScanner scanner;
+    uint32_t record = 0;
+    char path[64];
+
+    ASSERT_EQ(writer.Open(directory.path, sizeof(LogRecordHeader) + sizeof(record)), 0);
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+    ASSERT_EQ(writer.GetSegmentIndex(), 1);
+    writer.Close();
+
+    // Flip a payload byte in the first segment.
+    File segment;
+    directory.SegmentPath(path, 0);
+    ASSERT_EQ(segment.Open(path, EFileFlags::Write), 0);
+    ASSERT_EQ(segment.WriteAt(&directory, 1, sizeof(LogRecordHeader)), 1);
+    segment.Close();
+
+    ASSERT_EQ(scanner.Open(directory.path), 0);
+    ASSERT_EQ(scanner.Next(membuf(&record, sizeof(record))), -EBADMSG);
+}
+
+struct AppenderContext
+{
+    LogWriter *writer;
+    uint32_t thread;
+    uint32_t count;
+};
+
+static void *AppendRecords(void *parameter)
+{
+    AppenderContext *context = (AppenderContext *)parameter;
+    uint32_t record[2] = {context->thread, 0};
+
+    for (record[1] = 0; record[1] < context->count; record[1]++)
+    {
+        if (context->writer->Append(record, sizeof(record)) != 0)
+        {
+            return parameter;
+        }
+    }
+
+    return nullptr;
+}
+
+TEST(LogWriterTests, ConcurrentAppends)
+{
+    const uint32_t threadCount = 4, recordCount = 500;
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    LogScanner scanner;
+    pthread_t threads[threadCount];
+    AppenderContext contexts[threadCount];
+    uint32_t nextRecord[threadCount] = {0};
+    uint32_t record[2];
+
+    ASSERT_EQ(writer.Open(directory.path, 4096, 0, 1000), 0);
+
+    for (uint32_t index = 0; index < threadCount; index++)
+    {
+        contexts[index] = {&writer, index, recordCount};
+        ASSERT_EQ(pthread_create(&threads[index], nullptr, AppendRecords, &contexts[index]), 0);
+    }
+
+    for (uint32_t index = 0; index < threadCount; index++)
+    {
+        void *result;
+        ASSERT_EQ(pthread_join(threads[index], &result), 0);
+        ASSERT_EQ(result, nullptr);
+    }
+
+    ASSERT_EQ(writer.Sync(), 0);
+    writer.Close();
+
+    // Every thread's records appear exactly once, in the order it appended them.
+    ASSERT_EQ(scanner.Open(directory.path), 0);
+    for (uint32_t index = 0; index < threadCount * recordCount; index++)
+    {
+        ASSERT_EQ(scanner.Next(membuf(record, sizeof(record))), sizeof(record));
+        ASSERT_LT(record[0], threadCount);
+        ASSERT_EQ(record[1], nextRecord[record[0]]++);
+    }
+    ASSERT_EQ(scanner.Next(membuf(record, sizeof(record))), 0);
+}
+
+TEST(LogWriterTests, SyncInterval)
+{
+    TemporaryLogDirectory directory;
+    LogWriter writer;
+    uint32_t record = 7;
+
+    // Only the time window can trigger a sync.
+    ASSERT_EQ(writer.Open(directory.path, 1 << 20, 1 << 20, 20000), 0);
+    ASSERT_EQ(writer.Append(&record, sizeof(record)), 0);
+
+    // The log goes idle; the background sync still makes the record durable.
+    for (int attempt = 0; (attempt < 1000) && (writer.GetUnsyncedLength() > 0); attempt++)
+    {
+        usleep(1000);
+    }
+    ASSERT_EQ(writer.GetUnsyncedLength(), 0);
+
+    writer.Close();
+    ASSERT_FALSE(writer.IsOpen());
+}
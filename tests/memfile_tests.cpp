@@ -0,0 +1,105 @@
+/**
+ * @file memfile_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/MemFile.h>
+#include <Kraken/Collections.h>
+
+using namespace Kraken;
+
+TEST(MemFileTests, SealedSharing)
+{
+    const uint8_t frame[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    MemFile producer;
+    ESeals seals;
+
+    ASSERT_EQ(producer.Open("frame", 4096), 0);
+    ASSERT_EQ(producer.Open("frame", 4096), -EBUSY);
+
+    {
+        MemoryMapping mapping;
+        ASSERT_EQ(producer.Map(mapping), 0);
+        ASSERT_EQ(mapping.GetLength(), 4096);
+
+        membuf mem = mapping;
+        memcpy(mem.buffer, frame, sizeof(frame));
+    }
+
+    ASSERT_EQ(producer.AddSeals(ESeals::Shrink | ESeals::Grow | ESeals::Write | ESeals::Seal), 0);
+    ASSERT_EQ(producer.GetSeals(seals), 0);
+    ASSERT_EQ(seals, ESeals::Shrink | ESeals::Grow | ESeals::Write | ESeals::Seal);
+
+    ASSERT_EQ(producer.Write(frame), -EPERM);
+    ASSERT_EQ(producer.Truncate(0), -EPERM);
+    ASSERT_EQ(producer.AddSeals(ESeals::FutureWrite), -EPERM);
+
+    // A consumer sees the data through its own descriptor.
+    MemFile consumer(dup(producer.GetFileDescriptor()));
+    MemoryMapping view;
+
+    ASSERT_EQ(consumer.Map(view), -EPERM);
+    ASSERT_EQ(consumer.Map(view, EProtection::Read), 0);
+
+    const_membuf data = view;
+    ASSERT_EQ(memcmp(data.buffer, frame, sizeof(frame)), 0);
+}
+
+TEST(MemFileTests, HugeTLB)
+{
+    MemFile file;
+
+    int err = file.Open("huge", 2 << 20, EMemFileFlags::CloseOnExec | EMemFileFlags::HugeTLB);
+    if ((err == -EINVAL) || (err == -ENOMEM) || (err == -ENOENT))
+    {
+        GTEST_SKIP() << "Huge pages are unavailable";
+    }
+    ASSERT_EQ(err, 0);
+
+    MemoryMapping mapping;
+    err = file.Map(mapping);
+    if (err == -ENOMEM)
+    {
+        GTEST_SKIP() << "No free huge pages";
+    }
+    ASSERT_EQ(err, 0);
+}
+
+TEST(MemoryMappingTests, Anonymous)
+{
+    MemoryMapping mapping;
+
+    ASSERT_FALSE(mapping.IsMapped());
+    ASSERT_EQ(mapping.MapAnonymous(8192), 0);
+    ASSERT_EQ(mapping.MapAnonymous(8192), -EBUSY);
+    ASSERT_TRUE(mapping.IsMapped());
+
+    membuf mem = mapping;
+    ASSERT_EQ(mem.length, 8192);
+    ASSERT_EQ(((unsigned char *)mem.buffer)[4096], 0);
+
+    mapping.Unmap();
+    ASSERT_FALSE(mapping.IsMapped());
+}
+
+TEST(MemoryMappingTests, Trim)
+{
+    MemoryMapping mapping;
+
+    ASSERT_EQ(mapping.Trim(0, 4096), -EINVAL);
+    ASSERT_EQ(mapping.MapAnonymous(4 * 4096), 0);
+
+    unsigned char *start = (unsigned char *)mapping.GetAddress();
+    ASSERT_EQ(mapping.Trim(100, 4096), -EINVAL);
+    ASSERT_EQ(mapping.Trim(4096, 4 * 4096), -EINVAL);
+
+    ASSERT_EQ(mapping.Trim(4096, 2 * 4096), 0);
+    ASSERT_EQ(mapping.GetAddress(), start + 4096);
+    ASSERT_EQ(mapping.GetLength(), 2 * 4096);
+    ASSERT_EQ(((unsigned char *)mapping.GetAddress())[2 * 4096 - 1], 0);
+
+    mapping.Unmap();
+}
@@ -0,0 +1,204 @@
+/**
+ * @file packet_ring_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/PacketRing.h>
+
+using namespace Kraken;
+
+#define OPEN_PACKET_SOCKET_OR_SKIP(socket) \
+    do { \
+        int _err = (socket).Open(ESocketType::Raw, 0); \
+        if ((_err == -EPERM) || (_err == -EAFNOSUPPORT)) { GTEST_SKIP() << "Packet sockets are unavailable"; } \
+        ASSERT_EQ(_err, 0); \
+    } while (0)
+
+// Local experimental ethertypes, so the tests only see their own frames.
+static const uint16_t s_RingProtocol = 0x88B5;
+static const uint16_t s_FanoutProtocol = 0x88B6;
+static const uint16_t s_ErrorProtocol = 0x88B7;
+
+static size_t BuildFrame(uint8_t *o_frame, uint16_t protocol, uint8_t marker)
+{
+    const size_t length = ETH_ZLEN;
+
+    // Loopback has an all-zero hardware address.
+    memset(o_frame, 0, length);
+    o_frame[12] = (uint8_t)(protocol >> 8);
+    o_frame[13] = (uint8_t)protocol;
+    o_frame[ETH_HLEN] = marker;
+
+    return length;
+}
+
+TEST(PacketRingTests, Address)
+{
+    PacketAddress address("lo", s_RingProtocol);
+    PacketAddress missing("kraken-missing0");
+
+    ASSERT_TRUE(address.IsValid());
+    ASSERT_EQ(address.GetInterfaceIndex(), (int)if_nametoindex("lo"));
+    ASSERT_EQ(address.GetProtocol(), s_RingProtocol);
+    ASSERT_FALSE(missing.IsValid());
+}
+
+TEST(PacketRingTests, TransmitAndReceive)
+{
+    const PacketAddress address("lo", s_RingProtocol);
+    PacketSocket receiver, transmitter;
+    PacketReceiveRing receiveRing;
+    PacketTransmitRing transmitRing;
+    PacketBlock block;
+
+    OPEN_PACKET_SOCKET_OR_SKIP(receiver);
+    OPEN_PACKET_SOCKET_OR_SKIP(transmitter);
+
+    // Set the ring up before binding, so no frame is missed.
+    ASSERT_EQ(receiveRing.Open(receiver, 4 * 4096, 8), 0);
+    ASSERT_EQ(receiveRing.Open(receiver, 4 * 4096, 8), -EBUSY);
+    ASSERT_EQ(receiver.Bind(address), 0);
+
+    ASSERT_EQ(transmitRing.Open(transmitter, 4096, 2), 0);
+    ASSERT_EQ(transmitRing.GetFrameCount(), 4);
+    ASSERT_EQ(transmitter.Bind(address), 0);
+
+    // Fill the whole ring.
+    size_t totalLength = 0;
+    for (uint8_t marker = 0; marker < 4; marker++)
+    {
+        membuf slot = transmitRing.Acquire();
+        ASSERT_NE(slot.buffer, nullptr);
+        ASSERT_GE(slot.length, ETH_ZLEN);
+
+        size_t length = BuildFrame((uint8_t *)slot.buffer, s_RingProtocol, marker);
+        ASSERT_EQ(transmitRing.Commit(length), 0);
+        totalLength += length;
+    }
+
+    ASSERT_EQ(transmitRing.Acquire().buffer, nullptr);
+    ASSERT_EQ(transmitRing.Commit(ETH_ZLEN), -ENOBUFS);
+    ASSERT_EQ(transmitRing.Flush(true), (ssize_t)totalLength);
+
+    // Frames arrive in order, possibly spread over several blocks.
+    uint8_t expected = 0;
+    while (expected < 4)
+    {
+        ASSERT_EQ(receiveRing.Next(block, 1000), 0);
+
+        for (PacketFrame frame : block)
+        {
+            const uint8_t *data = (const uint8_t *)frame.GetData().buffer;
+
+            ASSERT_EQ(frame.GetData().length, ETH_ZLEN);
+            ASSERT_FALSE(frame.IsTruncated());
+            ASSERT_EQ(frame.GetProtocol(), s_RingProtocol);
+            ASSERT_EQ(frame.GetInterfaceIndex(), address.GetInterfaceIndex());
+            ASSERT_NE(frame.GetTimestamp().tv_sec, 0);
+            ASSERT_EQ(data[ETH_HLEN], expected++);
+        }
+
+        receiveRing.Release(block);
+    }
+
+    ASSERT_EQ(receiveRing.Next(block, 0), -EAGAIN);
+
+    // The transmitted slots become available again.
+    ASSERT_NE(transmitRing.Acquire().buffer, nullptr);
+    ASSERT_EQ(transmitRing.Commit(transmitRing.GetMaxFrameLength() + 1), -EMSGSIZE);
+}
+
+TEST(PacketRingTests, Fanout)
+{
+    const PacketAddress address("lo", s_FanoutProtocol);
+    const uint16_t groupId = (uint16_t)getpid();
+    PacketSocket members[2], sender;
+    uint8_t frame[ETH_FRAME_LEN];
+    size_t received[2] = {0, 0};
+
+    for (auto &member : members)
+    {
+        OPEN_PACKET_SOCKET_OR_SKIP(member);
+        ASSERT_EQ(member.Bind(address), 0);
+        ASSERT_EQ(member.JoinFanout(groupId, EPacketFanoutMode::LoadBalance), 0);
+    }
+
+    OPEN_PACKET_SOCKET_OR_SKIP(sender);
+    ASSERT_EQ(sender.Bind(address), 0);
+
+    for (uint8_t marker = 0; marker < 4; marker++)
+    {
+        size_t length = BuildFrame(frame, s_FanoutProtocol, marker);
+        ASSERT_EQ(sender.Send(frame, length), (ssize_t)length);
+    }
+
+    // Round-robin splits the frames evenly.
+    for (size_t index = 0; index < 2; index++)
+    {
+        while (members[index].Receive(frame, sizeof(frame), EReceiveFlags::DoNotWait) > 0)
+        {
+            received[index]++;
+        }
+    }
+
+    ASSERT_EQ(received[0], 2);
+    ASSERT_EQ(received[1], 2);
+}
+
+TEST(PacketRingTests, SingleRingPerSocket)
+{
+    PacketSocket socket;
+    PacketReceiveRing receiveRing;
+    PacketTransmitRing transmitRing;
+
+    OPEN_PACKET_SOCKET_OR_SKIP(socket);
+
+    ASSERT_EQ(receiveRing.Open(socket, 4096, 4), 0);
+    ASSERT_EQ(transmitRing.Open(socket, 4096, 2), -EBUSY);
+    ASSERT_FALSE(transmitRing.IsOpen());
+
+    // Closing a ring frees the socket for another.
+    receiveRing.Close();
+    ASSERT_EQ(transmitRing.Open(socket, 4096, 2), 0);
+    ASSERT_EQ(receiveRing.Open(socket, 4096, 4), -EBUSY);
+}
+
+TEST(PacketRingTests, NextDeadlineAndErrors)
+{
+    const PacketAddress address("lo", s_RingProtocol);
+    const PacketAddress destination("lo", s_ErrorProtocol);
+    PacketSocket socket;
+    PacketReceiveRing ring;
+    PacketBlock block;
+    struct timespec before, after;
+    uint8_t frame[ETH_ZLEN];
+
+    OPEN_PACKET_SOCKET_OR_SKIP(socket);
+    ASSERT_EQ(ring.Open(socket, 4096, 4), 0);
+    ASSERT_EQ(socket.Bind(address), 0);
+
+    // Nothing arrives; the wait ends at the deadline.
+    ASSERT_EQ(clock_gettime(CLOCK_MONOTONIC, &before), 0);
+    ASSERT_EQ(ring.Next(block, 50), -EAGAIN);
+    ASSERT_EQ(clock_gettime(CLOCK_MONOTONIC, &after), 0);
+    ASSERT_GE((after.tv_sec - before.tv_sec) * 1000 + (after.tv_nsec - before.tv_nsec) / 1000000, 49);
+
+    // A transmit timestamp of a frame the ring doesn't capture raises `POLLERR` without a socket error.
+    ASSERT_EQ(socket.SetOption<SocketOption::Timestamping>(ETimestampingFlags::TransmitSoftware |
+                                                           ETimestampingFlags::Software |
+                                                           ETimestampingFlags::TimestampOnly), 0);
+
+    size_t length = BuildFrame(frame, s_ErrorProtocol, 0);
+    ASSERT_EQ(socket.Send(frame, length, destination), (ssize_t)length);
+    ASSERT_EQ(ring.Next(block, 1000), -ENOMSG);
+
+    // Draining the error queue clears it.
+    TransmitTimestamp transmitted[2];
+    ASSERT_EQ(socket.ReadTransmitTimestamps(transmitted), 1);
+    ASSERT_EQ(transmitted[0].type, ETimestampType::Sent);
+    ASSERT_NE(transmitted[0].time.tv_sec, 0);
+    ASSERT_EQ(ring.Next(block, 0), -EAGAIN);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file parallel_reader_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/ParallelReader.h>
+#include <Kraken/Collections.h>
+
+using namespace Kraken;
+
+static const size_t s_FileSize = (1 << 20) + 1000;
+static const size_t s_ChunkSize = 1 << 16;
+
+/**
+ * Creates a temporary file whose every 32-bit word holds its own offset.
+ */
+static int CreatePatternFile(File &o_file)
+{
+    uint32_t words[1024];
+
+    int err = o_file.OpenTemporary("/tmp");
+    if (err != 0)
+    {
+        return err;
+    }
+
+    for (size_t offset = 0; offset < s_FileSize; offset += sizeof(words))
+    {
+        for (size_t index = 0; index < 1024; index++)
+        {
+            words[index] = (uint32_t)(offset + index * sizeof(uint32_t));
+        }
+
+        size_t length = (s_FileSize - offset < sizeof(words)) ? (s_FileSize - offset) : sizeof(words);
+        if (o_file.WriteAt(words, length, (off_t)offset) != (ssize_t)length)
+        {
+            return -EIO;
+        }
+    }
+
+    return 0;
+}
+
+static bool IsPatternValid(off_t offset, const_membuf data)
+{
+    for (size_t index = 0; index + sizeof(uint32_t) <= data.length; index += sizeof(uint32_t))
+    {
+        uint32_t word;
+        memcpy(&word, (const unsigned char *)data.buffer + index, sizeof(word));
+
+        if (word != (uint32_t)offset + index)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+struct OrderedContext
+{
+    off_t nextOffset;
+    bool isValid;
+};
+
+static int CheckOrdered(void *context, off_t offset, const_membuf data)
+{
+    OrderedContext *state = (OrderedContext *)context;
+
+    state->isValid = state->isValid && (offset == state->nextOffset) && IsPatternValid(offset, data);
+    state->nextOffset += data.length;
+
+    return 0;
+}
+
+struct UnorderedContext
+{
+    size_t bytes;
+    size_t chunks;
+    bool isValid;
+};
+
+static int CheckUnordered(void *context, off_t offset, const_membuf data)
+{
+    UnorderedContext *state = (UnorderedContext *)context;
+
+    if (!IsPatternValid(offset, data) || (offset % s_ChunkSize != 0))
+    {
+        __atomic_store_n(&state->isValid, false, __ATOMIC_RELAXED);
+    }
+
+    __atomic_add_fetch(&state->bytes, data.length, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&state->chunks, 1, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+static int StopAtSecondChunk(void *, off_t offset, const_membuf)
+{
+    return (offset == (off_t)s_ChunkSize) ? -ECANCELED : 0;
+}
+
+TEST(ParallelReaderTests, InOrder)
+{
+    static aligned_buffer<8 * s_ChunkSize> storage;
+    File file;
+
+    ASSERT_EQ(CreatePatternFile(file), 0);
+    ParallelReader<4> reader(file, storage, s_ChunkSize);
+
+    OrderedContext whole = {0, true};
+    ASSERT_EQ(reader.Read(0, 0, CheckOrdered, &whole), 0);
+    ASSERT_TRUE(whole.isValid);
+    ASSERT_EQ(whole.nextOffset, s_FileSize);
+
+    // A region that ends in the middle of a chunk.
+    OrderedContext region = {s_ChunkSize, true};
+    ASSERT_EQ(reader.Read(s_ChunkSize, 3 * s_ChunkSize + 12, CheckOrdered, &region), 0);
+    ASSERT_TRUE(region.isValid);
+    ASSERT_EQ(region.nextOffset, 4 * s_ChunkSize + 12);
+}
+
+TEST(ParallelReaderTests, AnyOrder)
+{
+    static aligned_buffer<6 * s_ChunkSize> storage;
+    File file;
+    UnorderedContext state = {0, 0, true};
+
+    ASSERT_EQ(CreatePatternFile(file), 0);
+    ParallelReader<3> reader(file, storage, s_ChunkSize);
+
+    ASSERT_EQ(reader.Read(0, 0, CheckUnordered, &state, EChunkOrder::AnyOrder), 0);
+    ASSERT_TRUE(state.isValid);
+    ASSERT_EQ(state.bytes, s_FileSize);
+    ASSERT_EQ(state.chunks, (s_FileSize + s_ChunkSize - 1) / s_ChunkSize);
+}
+
+TEST(ParallelReaderTests, SingleThread)
+{
+    static aligned_buffer<2 * s_ChunkSize> storage;
+    File file;
+    OrderedContext state = {0, true};
+
+    ASSERT_EQ(CreatePatternFile(file), 0);
+    ParallelReader<1> reader(file, storage, s_ChunkSize);
+
+    ASSERT_EQ(reader.Read(0, 0, CheckOrdered, &state), 0);
+    ASSERT_TRUE(state.isValid);
+    ASSERT_EQ(state.nextOffset, s_FileSize);
+}
+
+TEST(ParallelReaderTests, Errors)
+{
+    static aligned_buffer<2 * s_ChunkSize> storage;
+    File file;
+
+    ASSERT_EQ(CreatePatternFile(file), 0);
+
+    ParallelReader<4> reader(file, storage, s_ChunkSize);
+    ASSERT_EQ(reader.Read(0, 0, StopAtSecondChunk, nullptr), -ECANCELED);
+
+    ParallelReader<4> tooSmall(file, storage, 4 * s_ChunkSize);
+    ASSERT_EQ(tooSmall.Read(0, 0, StopAtSecondChunk, nullptr), -EINVAL);
+
+    File closed;
+    ParallelReader<2> badFile(closed, storage, s_ChunkSize);
+    ASSERT_EQ(badFile.Read(0, 0, StopAtSecondChunk, nullptr), -EBADF);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file pinned_region_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/PinnedRegion.h>
+
+using namespace Kraken;
+
+TEST(PinnedRegionTests, Allocate)
+{
+    PinnedRegion region;
+
+    ASSERT_FALSE(region.IsOpen());
+    ASSERT_EQ(region.Allocate(16).buffer, nullptr);
+
+    // Falls back to regular pages where no huge pages are reserved.
+    ASSERT_EQ(region.Open(1000), 0);
+    ASSERT_EQ(region.Open(1000), -EBUSY);
+    ASSERT_TRUE(region.IsOpen());
+    ASSERT_EQ(region.GetLength(), PinnedRegion::s_HugePageSize);
+
+    membuf first = region.Allocate(100);
+    membuf second = region.Allocate(4096, 4096);
+
+    ASSERT_NE(first.buffer, nullptr);
+    ASSERT_EQ(first.length, 100);
+    ASSERT_EQ((uintptr_t)second.buffer % 4096, 0);
+    ASSERT_GE((unsigned char *)second.buffer, (unsigned char *)first.buffer + first.length);
+    ASSERT_EQ(region.GetAvailable(), region.GetLength() - 8192);
+
+    memset(second.buffer, 0xAB, second.length);
+
+    ASSERT_EQ(region.Allocate(region.GetLength()).buffer, nullptr);
+    ASSERT_EQ(region.Allocate(16, 3).buffer, nullptr);
+
+    region.Reset();
+    ASSERT_EQ(region.GetAvailable(), region.GetLength());
+    ASSERT_EQ(region.Allocate(region.GetLength()).buffer, first.buffer);
+
+    region.Close();
+    ASSERT_FALSE(region.IsOpen());
+}
+
+TEST(PinnedRegionTests, TransparentHugePagesFallback)
+{
+    PinnedRegion region;
+
+    // Skips the reserved huge pages altogether.
+    ASSERT_EQ(region.Open(3 << 20, EPinnedRegionFlags::TransparentHugePages | EPinnedRegionFlags::Prefault), 0);
+    ASSERT_FALSE(region.IsHugeTLB());
+    ASSERT_EQ(region.GetLength(), 2 * PinnedRegion::s_HugePageSize);
+
+    // The region starts on a huge page, so all of it can be backed by huge pages.
+    membuf mem = region.Allocate(region.GetLength(), PinnedRegion::s_HugePageSize);
+    ASSERT_NE(mem.buffer, nullptr);
+    ASSERT_EQ(((unsigned char *)mem.buffer)[mem.length - 1], 0);
+}
+
+TEST(PinnedRegionTests, Lock)
+{
+    PinnedRegion region;
+
+    int err = region.Open(1, EPinnedRegionFlags::Default | EPinnedRegionFlags::Lock);
+    if ((err == -EPERM) || (err == -ENOMEM))
+    {
+        GTEST_SKIP() << "RLIMIT_MEMLOCK is too low";
+    }
+    ASSERT_EQ(err, 0);
+    ASSERT_NE(region.Allocate(4096).buffer, nullptr);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file pipe_pool_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/PipePool.h>
+
+using namespace Kraken;
+
+TEST(PipePoolTests, AcquireRelease)
+{
+    const uint8_t data[4] = {1, 2, 3, 4};
+    uint8_t output[4];
+    PipePool<2> pool;
+    PipePair *pipes[2];
+    PipePair other;
+    size_t capacity, pending;
+
+    ASSERT_FALSE(pool.IsOpen());
+    ASSERT_EQ(pool.Open(1 << 18), 0);
+    ASSERT_EQ(pool.Open(1 << 18), -EBUSY);
+    ASSERT_EQ(pool.Available(), 2);
+
+    pipes[0] = pool.Acquire();
+    pipes[1] = pool.Acquire();
+    ASSERT_NE(pipes[0], nullptr);
+    ASSERT_NE(pipes[1], nullptr);
+    ASSERT_NE(pipes[0], pipes[1]);
+    ASSERT_EQ(pool.Acquire(), nullptr);
+
+    ASSERT_EQ(pipes[0]->readEnd.GetPipeCapacity(capacity), 0);
+    ASSERT_EQ(capacity, 1 << 18);
+
+    // A drained pipe is returned as-is.
+    fd_t descriptor = pipes[0]->readEnd.GetFileDescriptor();
+    ASSERT_EQ(pipes[0]->writeEnd.Write(data), sizeof(data));
+    ASSERT_EQ(pipes[0]->readEnd.Read(output, sizeof(output)), sizeof(output));
+    ASSERT_EQ(pool.Release(pipes[0]), 0);
+    ASSERT_EQ(pool.Acquire(), pipes[0]);
+    ASSERT_EQ(pipes[0]->readEnd.GetFileDescriptor(), descriptor);
+
+    // A pipe with leftovers is replaced.
+    ASSERT_EQ(pipes[1]->writeEnd.Write(data), sizeof(data));
+    ASSERT_EQ(pool.Release(pipes[1]), 0);
+    ASSERT_EQ(pool.Acquire(), pipes[1]);
+    ASSERT_EQ(pipes[1]->readEnd.GetPendingLength(pending), 0);
+    ASSERT_EQ(pending, 0);
+    ASSERT_EQ(pipes[1]->readEnd.GetPipeCapacity(capacity), 0);
+    ASSERT_EQ(capacity, 1 << 18);
+
+    ASSERT_EQ(pool.Release(&other), -EINVAL);
+    ASSERT_EQ(pool.Release((PipePair *)((uint8_t *)pipes[0] + 1)), -EINVAL);
+
+    // A double release doesn't hand the pipe out twice.
+    ASSERT_EQ(pool.Release(pipes[0]), 0);
+    ASSERT_EQ(pool.Release(pipes[0]), -EINVAL);
+    ASSERT_EQ(pool.Available(), 1);
+
+    pool.Close();
+    ASSERT_FALSE(pool.IsOpen());
+    ASSERT_FALSE(pipes[0]->readEnd.IsOpen());
+    ASSERT_EQ(pool.Release(pipes[1]), -EINVAL);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file record_reader_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/RecordReader.h>
+#include <Kraken/ByteScan.h>
+
+using namespace Kraken;
+
+/**
+ * A read-only stream over a string, returning at most `chunk` bytes per read.
+ */
+class StringStream : public IStream
+{
+public:
+    using IStream::Read;
+    using IStream::Write;
+
+    StringStream(const char *data, size_t chunk) : m_data(data), m_length(strlen(data)), m_chunk(chunk) {}
+
+    ssize_t Read(void *o_buffer, size_t length) override
+    {
+        size_t count = (length < m_chunk) ? length : m_chunk;
+        count = (count < m_length) ? count : m_length;
+
+        memcpy(o_buffer, m_data, count);
+        m_data += count;
+        m_length -= count;
+
+        return (ssize_t)count;
+    }
+
+    ssize_t Write(const void *, size_t) override
+    {
+        return -EBADF;
+    }
+
+private:
+    const char *m_data;
+    size_t m_length;
+    size_t m_chunk;
+};
+
+static bool RecordEquals(const_membuf record, const char *expected)
+{
+    return (record.length == strlen(expected)) && (memcmp(record.buffer, expected, record.length) == 0);
+}
+
+TEST(ByteScanTests, MatchesScalarSearch)
+{
+    unsigned char data[200];
+
+    for (size_t index = 0; index < sizeof(data); index++)
+    {
+        data[index] = (unsigned char)('a' + index % 7);
+    }
+
+    // Place the needle at every position, and scan from every offset.
+    for (size_t position = 0; position < sizeof(data) - 1; position++)
+    {
+        data[position] = '\r';
+        data[position + 1] = '\n';
+
+        for (size_t offset = 0; offset <= position; offset += 3)
+        {
+            size_t length = sizeof(data) - offset;
+            ASSERT_EQ(FindByte(data + offset, length, '\r'), data + position);
+            ASSERT_EQ(FindBytePair(data + offset, length, '\r', '\n'), data + position);
+            ASSERT_EQ(FindBytePair(data + offset, position + 1 - offset, '\r', '\n'), nullptr);
+        }
+
+        data[position] = (unsigned char)('a' + position % 7);
+        data[position + 1] = (unsigned char)('a' + (position + 1) % 7);
+    }
+
+    ASSERT_EQ(FindByte(data, sizeof(data), 'z'), nullptr);
+    ASSERT_EQ(FindByte(data, 0, 'a'), nullptr);
+    ASSERT_EQ(FindBytePair(data, 1, 'a', 'b'), nullptr);
+}
+
+TEST(RecordReaderTests, Lines)
+{
+    const char *expected[] = {"first", "", "third line", "last"};
+
+    // Small reads force records to span reads.
+    for (size_t chunk = 1; chunk < 8; chunk++)
+    {
+        StringStream stream("first\n\nthird line\nlast", chunk);
+        RecordReader<16> reader(stream);
+
+        for (const char *line : expected)
+        {
+            ASSERT_EQ(reader.Next(), 0);
+            ASSERT_TRUE(RecordEquals(reader.GetRecord(), line));
+        }
+
+        ASSERT_EQ(reader.Next(), -ENODATA);
+        ASSERT_EQ(reader.Next(), -ENODATA);
+    }
+}
+
+TEST(RecordReaderTests, CRLF)
+{
+    const char *expected[] = {"a\rb", "syslog message", "c\n"};
+
+    for (size_t chunk = 1; chunk < 8; chunk++)
+    {
+        StringStream stream("a\rb\r\nsyslog message\r\nc\n\r\n", chunk);
+        RecordReader<32> reader(stream, '\r', '\n');
+
+        for (const char *line : expected)
+        {
+            ASSERT_EQ(reader.Next(), 0);
+            ASSERT_TRUE(RecordEquals(reader.GetRecord(), line));
+        }
+
+        ASSERT_EQ(reader.Next(), -ENODATA);
+    }
+}
+
+TEST(RecordReaderTests, OversizedRecord)
+{
+    StringStream stream("0123456789abcdef,tail,", 64);
+    RecordReader<8> reader(stream, ',');
+
+    ASSERT_EQ(reader.Next(), -ENOBUFS);
+    ASSERT_TRUE(RecordEquals(reader.GetRecord(), "01234567"));
+    ASSERT_EQ(reader.Next(), -ENOBUFS);
+    ASSERT_TRUE(RecordEquals(reader.GetRecord(), "89abcdef"));
+    ASSERT_EQ(reader.Next(), 0);
+    ASSERT_TRUE(RecordEquals(reader.GetRecord(), ""));
+    ASSERT_EQ(reader.Next(), 0);
+    ASSERT_TRUE(RecordEquals(reader.GetRecord(), "tail"));
+    ASSERT_EQ(reader.Next(), -ENODATA);
+}
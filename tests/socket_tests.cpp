@@ -164,4 +164,559 @@ TEST_F(SocketTest, Pair)
     ASSERT_EQ(b.Receive(buffer1), sizeof(buffer1));
 
     ASSERT_EQ(-EBUSY, UnixSocket::Pair(ESocketType::Datagram, a, b));
-}
\ No newline at end of file
+}
+
+TEST_F(SocketTest, BatchSendReceive)
+{
+    const uint8_t payloads[3][4] = {{1}, {2, 2}, {3, 3, 3}};
+    const_membuf datagrams[3] = {const_membuf(payloads[0], 1), const_membuf(payloads[1], 2), const_membuf(payloads[2], 3)};
+    const IPv4Address senderAddress("127.0.0.1", 0x6670);
+    const IPv4Address destinations[3] = {
+            IPv4Address("127.0.0.1", 0x6671), IPv4Address("127.0.0.1", 0x6671), IPv4Address("127.0.0.1", 0x6671)};
+    uint8_t storage[4][16];
+    membuf buffers[4] = {membuf(storage[0]), membuf(storage[1]), membuf(storage[2]), membuf(storage[3])};
+    size_t lengths[4] = {0};
+    IPv4Address senders[4];
+    IPv4Socket sender, receiver;
+
+    ASSERT_EQ(sender.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(sender.Bind(senderAddress), 0);
+    ASSERT_EQ(receiver.Bind(destinations[0]), 0);
+
+    ASSERT_EQ(sender.SendBatch(datagrams, destinations), 3);
+    ASSERT_EQ(receiver.ReceiveBatch(buffers, lengths, senders, EReceiveFlags::WaitForOne), 3);
+
+    for (size_t index = 0; index < 3; index++)
+    {
+        ASSERT_EQ(lengths[index], index + 1);
+        ASSERT_EQ(memcmp(storage[index], payloads[index], lengths[index]), 0);
+        ASSERT_EQ(memcmp(&senders[index], &senderAddress, sizeof(senderAddress)), 0);
+    }
+
+    // A partial batch through a connected socket.
+    ASSERT_EQ(sender.Connect(destinations[0]), 0);
+    ASSERT_EQ(sender.SendBatch(datagrams, ESendFlags::None, 2), 2);
+    ASSERT_EQ(receiver.ReceiveBatch(buffers, lengths, EReceiveFlags::WaitForOne), 2);
+    ASSERT_EQ(lengths[1], 2);
+
+    ASSERT_EQ(receiver.ReceiveBatch(buffers, lengths, EReceiveFlags::NonBlock), -EAGAIN);
+}
+
+TEST_F(SocketTest, SendZeroCopy)
+{
+    static uint8_t payload[64 * 1024];
+    static uint8_t output[sizeof(payload)];
+    IPv4Socket server, client, remoteClient;
+    ZeroCopyCompletion completions[4];
+    uint32_t id = ~0U;
+
+    ASSERT_EQ(server.Open(ESocketType::Stream), 0);
+    ASSERT_EQ(remoteClient.Open(ESocketType::Stream), 0);
+    ASSERT_EQ(server.Bind(IPv4Address("127.0.0.1", 0x6672)), 0);
+    ASSERT_EQ(server.Listen(1), 0);
+    ASSERT_EQ(remoteClient.Connect(IPv4Address("127.0.0.1", 0x6672)), 0);
+    ASSERT_EQ(server.Accept(client), 0);
+
+    for (uint32_t expected = 0; expected < 3; expected++)
+    {
+        ASSERT_EQ(remoteClient.SendZeroCopy(payload, sizeof(payload), id), sizeof(payload));
+        ASSERT_EQ(id, expected);
+
+        size_t received = 0;
+        while (received < sizeof(payload))
+        {
+            ssize_t res = client.Receive(output, sizeof(output) - received);
+            ASSERT_GT(res, 0);
+            received += (size_t)res;
+        }
+    }
+
+    // Completions may be coalesced into ranges, and arrive a bit after the data.
+    uint32_t completed = 0;
+    for (int attempt = 0; (attempt < 1000) && (completed < 3); attempt++)
+    {
+        int count = remoteClient.ReadZeroCopyCompletions(completions);
+        ASSERT_GE(count, 0);
+
+        for (int index = 0; index < count; index++)
+        {
+            ASSERT_EQ(completions[index].first, completed);
+            ASSERT_GE(completions[index].last, completions[index].first);
+            completed = completions[index].last + 1;
+        }
+
+        if (count == 0)
+        {
+            usleep(1000);
+        }
+    }
+
+    ASSERT_EQ(completed, 3);
+}
+
+TEST_F(SocketTest, SegmentationCoalescing)
+{
+    static uint8_t payload[4 * 1000];
+    static uint8_t output[64 * 1024];
+    const IPv4Address receiverAddress("127.0.0.1", 0x6673);
+    IPv4Address senderAddress;
+    IPv4Socket sender, receiver;
+    uint16_t segmentSize = 0;
+
+    for (size_t index = 0; index < sizeof(payload); index++)
+    {
+        payload[index] = (uint8_t)(index / 1000);
+    }
+
+    ASSERT_EQ(sender.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Bind(receiverAddress), 0);
+    ASSERT_EQ(receiver.EnableCoalescing(), 0);
+
+    // Per-call segmentation; the last datagram is shorter.
+    ASSERT_EQ(sender.SendSegmented(payload, sizeof(payload) - 10, 1000, receiverAddress), sizeof(payload) - 10);
+
+    size_t received = 0;
+    while (received < sizeof(payload) - 10)
+    {
+        ssize_t res = receiver.ReceiveCoalesced(output + received, sizeof(output) - received, segmentSize, senderAddress);
+        ASSERT_GT(res, 0);
+        ASSERT_EQ(segmentSize, (res > 1000) ? 1000 : res);
+        received += (size_t)res;
+    }
+    ASSERT_EQ(memcmp(output, payload, received), 0);
+
+    // Per-socket segmentation, with a plain send.
+    ASSERT_EQ(sender.Connect(receiverAddress), 0);
+    ASSERT_EQ(sender.SetSegmentSize(1000), 0);
+    ASSERT_EQ(sender.Send(payload, sizeof(payload)), sizeof(payload));
+
+    received = 0;
+    while (received < sizeof(payload))
+    {
+        ssize_t res = receiver.ReceiveCoalesced(output + received, sizeof(output) - received, segmentSize);
+        ASSERT_GT(res, 0);
+        ASSERT_EQ(segmentSize, 1000);
+        received += (size_t)res;
+    }
+}
+
+static_assert(!SocketOption::NoDelay::IsApplicable(ESocketDomain::Unix), "TCP options must not apply to Unix sockets.");
+static_assert(!SocketOption::TypeOfService::IsApplicable(ESocketDomain::IPv6), "IPv4 options must not apply to IPv6 sockets.");
+static_assert(!SocketOption::Error::IsWritable(), "SO_ERROR must be read-only.");
+static_assert(!SocketOption::ZeroCopy::IsApplicable(ESocketDomain::Unix), "Unix sockets do not support zero-copy.");
+
+TEST_F(SocketTest, Options)
+{
+    IPv4Socket tcp;
+    UnixSocket unixSocket;
+    bool enabled = false;
+    int value = 0;
+    struct timeval timeout = {1, 500000};
+    struct timeval readTimeout = {0, 0};
+
+    ASSERT_EQ(tcp.Open(ESocketType::Stream), 0);
+
+    ASSERT_EQ(tcp.SetOption<SocketOption::NoDelay>(true), 0);
+    ASSERT_EQ(tcp.GetOption<SocketOption::NoDelay>(enabled), 0);
+    ASSERT_TRUE(enabled);
+
+    ASSERT_EQ(tcp.SetOption<SocketOption::NoDelay>(false), 0);
+    ASSERT_EQ(tcp.GetOption<SocketOption::NoDelay>(enabled), 0);
+    ASSERT_FALSE(enabled);
+
+    // The kernel doubles buffer sizes for bookkeeping.
+    ASSERT_EQ(tcp.SetOption<SocketOption::ReceiveBufferSize>(64 * 1024), 0);
+    ASSERT_EQ(tcp.GetOption<SocketOption::ReceiveBufferSize>(value), 0);
+    ASSERT_GE(value, 64 * 1024);
+
+    ASSERT_EQ(tcp.SetOption<SocketOption::TypeOfService>(0x10), 0);
+    ASSERT_EQ(tcp.GetOption<SocketOption::TypeOfService>(value), 0);
+    ASSERT_EQ(value, 0x10);
+
+    ASSERT_EQ(tcp.SetOption<SocketOption::ReceiveTimeout>(timeout), 0);
+    ASSERT_EQ(tcp.GetOption<SocketOption::ReceiveTimeout>(readTimeout), 0);
+    ASSERT_EQ(readTimeout.tv_sec, 1);
+    ASSERT_EQ(readTimeout.tv_usec, 500000);
+
+    ASSERT_EQ(tcp.GetOption<SocketOption::Error>(value), 0);
+    ASSERT_EQ(value, 0);
+
+    ASSERT_EQ(unixSocket.SetOption<SocketOption::PassCredentials>(true), -EBADF);
+    ASSERT_EQ(unixSocket.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(unixSocket.SetOption<SocketOption::PassCredentials>(true), 0);
+}
+
+TEST_F(SocketTest, AcceptBatch)
+{
+    const IPv4Address address("127.0.0.1", 0x6674);
+    IPv4Socket server, remoteClients[3], clients[4];
+
+    ASSERT_EQ(server.Open(ESocketType::Stream, ESocketFlags::NonBlock), 0);
+    ASSERT_EQ(server.Bind(address), 0);
+    ASSERT_EQ(server.Listen(4), 0);
+
+    ASSERT_EQ(server.AcceptBatch(clients), 0);
+
+    for (auto &remote : remoteClients)
+    {
+        ASSERT_EQ(remote.Open(ESocketType::Stream), 0);
+        ASSERT_EQ(remote.Connect(address), 0);
+    }
+
+    ASSERT_EQ(server.AcceptBatch(clients, EAcceptFlags::NonBlock | EAcceptFlags::CloseOnExec), 3);
+    ASSERT_FALSE(clients[3].IsOpen());
+
+    for (size_t index = 0; index < 3; index++)
+    {
+        ASSERT_TRUE(clients[index].IsOpen());
+        ASSERT_NE(fcntl(clients[index].GetFileDescriptor(), F_GETFL) & O_NONBLOCK, 0);
+        ASSERT_NE(fcntl(clients[index].GetFileDescriptor(), F_GETFD) & FD_CLOEXEC, 0);
+
+        uint8_t byte = 0;
+        ASSERT_EQ(clients[index].Receive(&byte, 1), -EAGAIN);
+    }
+
+    ASSERT_EQ(server.AcceptBatch(clients), -EBUSY);
+    ASSERT_EQ(server.Accept(clients[3]), -EAGAIN);
+}
+
+TEST_F(SocketTest, PassDescriptors)
+{
+    const uint8_t token[1] = {42};
+    uint8_t output[4] = {0};
+    uint8_t pipeOutput[4] = {0};
+    UnixSocket a, b;
+    File readEnd, writeEnd, receivedRead, receivedWrite, spare;
+    size_t count = 0;
+
+    ASSERT_EQ(UnixSocket::Pair(ESocketType::Stream, a, b), 0);
+    ASSERT_EQ(File::Pipe(readEnd, writeEnd), 0);
+
+    const File *const sent[2] = {&readEnd, &writeEnd};
+    File *const received[3] = {&receivedRead, &receivedWrite, &spare};
+
+    ASSERT_EQ(a.SendDescriptors(token, sent), sizeof(token));
+    ASSERT_EQ(b.ReceiveDescriptors(output, received, count), sizeof(token));
+    ASSERT_EQ(output[0], 42);
+    ASSERT_EQ(count, 2);
+    ASSERT_FALSE(spare.IsOpen());
+    ASSERT_NE(fcntl(receivedRead.GetFileDescriptor(), F_GETFD) & FD_CLOEXEC, 0);
+
+    // The received descriptors refer to the same pipe.
+    ASSERT_EQ(receivedWrite.Write(token), sizeof(token));
+    ASSERT_EQ(readEnd.Read(pipeOutput, sizeof(pipeOutput)), sizeof(token));
+    ASSERT_EQ(pipeOutput[0], 42);
+
+    ASSERT_EQ(b.ReceiveDescriptors(output, received, count), -EBUSY);
+}
+
+TEST_F(SocketTest, HandOffConnection)
+{
+    const uint8_t token[1] = {42};
+    uint8_t output[4] = {0};
+    UnixSocket a, b, connection, peer;
+    File receivedFile;
+    size_t count = 0;
+
+    ASSERT_EQ(UnixSocket::Pair(ESocketType::Stream, a, b), 0);
+    ASSERT_EQ(UnixSocket::Pair(ESocketType::Stream, connection, peer), 0);
+
+    const File *const sent[1] = {&connection};
+    File *const received[1] = {&receivedFile};
+
+    ASSERT_EQ(a.SendDescriptors(token, sent), sizeof(token));
+    ASSERT_EQ(b.ReceiveDescriptors(output, received, count), sizeof(token));
+    ASSERT_EQ(count, 1);
+
+    // Closing (rather than destroying) the sender's copy leaves the connection up.
+    connection.Close();
+
+    UnixSocket handed(receivedFile.Detach());
+    ASSERT_EQ(handed.Send(token, sizeof(token)), sizeof(token));
+    ASSERT_EQ(peer.Receive(output, sizeof(output)), sizeof(token));
+    ASSERT_EQ(peer.Send(token, sizeof(token)), sizeof(token));
+    ASSERT_EQ(handed.Receive(output, sizeof(output)), sizeof(token));
+    ASSERT_EQ(output[0], 42);
+}
+
+TEST_F(SocketTest, PassCredentials)
+{
+    const uint8_t token[1] = {7};
+    uint8_t output[4] = {0};
+    UnixSocket a, b;
+    struct ucred credentials;
+
+    ASSERT_EQ(UnixSocket::Pair(ESocketType::Datagram, a, b), 0);
+
+    ASSERT_EQ(a.SendCredentials(token), sizeof(token));
+    ASSERT_EQ(b.ReceiveCredentials(output, credentials), sizeof(token));
+    ASSERT_EQ(output[0], token[0]);
+    ASSERT_EQ(credentials.pid, 0);
+
+    ASSERT_EQ(b.SetOption<SocketOption::PassCredentials>(true), 0);
+    ASSERT_EQ(a.SendCredentials(token), sizeof(token));
+    ASSERT_EQ(b.ReceiveCredentials(output, credentials), sizeof(token));
+    ASSERT_EQ(credentials.pid, getpid());
+    ASSERT_EQ(credentials.uid, getuid());
+    ASSERT_EQ(credentials.gid, getgid());
+}
+
+TEST_F(SocketTest, SendReceiveMessage)
+{
+    const uint8_t header[2] = {0xAA, 0xBB};
+    const uint8_t body[4] = {1, 2, 3, 4};
+    uint8_t first[3] = {0}, second[8] = {0};
+    const_membuf outgoing[2] = {const_membuf(header), const_membuf(body)};
+    membuf incoming[2] = {membuf(first), membuf(second)};
+    const IPv4Address senderAddress("127.0.0.1", 0x6675);
+    const IPv4Address receiverAddress("127.0.0.1", 0x6676);
+    IPv4Address source;
+    IPv4Socket sender, receiver;
+    ControlBuffer<ControlSpace<struct in_pktinfo>::value> control;
+
+    ASSERT_EQ(sender.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(sender.Bind(senderAddress), 0);
+    ASSERT_EQ(receiver.Bind(receiverAddress), 0);
+
+    // Gather on send, scatter on receive.
+    ASSERT_EQ(sender.SendMessage(outgoing, receiverAddress), sizeof(header) + sizeof(body));
+    ASSERT_EQ(receiver.ReceiveMessage(incoming, source), sizeof(header) + sizeof(body));
+    ASSERT_EQ(memcmp(&source, &senderAddress, sizeof(source)), 0);
+    ASSERT_EQ(first[0], 0xAA);
+    ASSERT_EQ(first[1], 0xBB);
+    ASSERT_EQ(first[2], 1);
+    ASSERT_EQ(memcmp(second, body + 1, 3), 0);
+
+    // Control messages on both sides: the sent TTL, and the received destination address.
+    int ttl = 7;
+    ControlBuffer<ControlSpace<int>::value> outgoingControl;
+    ASSERT_EQ(outgoingControl.Add(SOL_IP, IP_TTL, ttl), 0);
+    ASSERT_EQ(outgoingControl.Add(SOL_IP, IP_TTL, ttl), -ENOBUFS);
+    ASSERT_EQ(receiver.SetOption<SocketOption::ReceivePacketInfo>(true), 0);
+
+    ASSERT_EQ(sender.SendMessage(outgoing, receiverAddress, outgoingControl), sizeof(header) + sizeof(body));
+    ASSERT_EQ(receiver.ReceiveMessage(incoming, control), sizeof(header) + sizeof(body));
+
+    size_t found = 0;
+    for (ControlMessage message : control.GetMessages())
+    {
+        struct in_pktinfo info;
+
+        ASSERT_TRUE(message.Is(SOL_IP, IP_PKTINFO));
+        ASSERT_TRUE(message.Get(info));
+        ASSERT_EQ(info.ipi_addr.s_addr, htonl(INADDR_LOOPBACK));
+        found++;
+    }
+    ASSERT_EQ(found, 1);
+}
+
+TEST_F(SocketTest, Timestamps)
+{
+    const uint8_t payload[8] = {1, 2, 3};
+    uint8_t output[16];
+    const IPv4Address receiverAddress("127.0.0.1", 0x6677);
+    IPv4Socket sender, receiver;
+    struct timespec before, received;
+    TransmitTimestamp transmitted[4];
+    ETimestampingFlags flags;
+
+    ASSERT_EQ(sender.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Bind(receiverAddress), 0);
+    ASSERT_EQ(sender.Connect(receiverAddress), 0);
+
+    ASSERT_EQ(receiver.SetOption<SocketOption::TimestampNanoseconds>(true), 0);
+    ASSERT_EQ(sender.SetOption<SocketOption::Timestamping>(ETimestampingFlags::TransmitSoftware |
+                                                           ETimestampingFlags::Software |
+                                                           ETimestampingFlags::Id |
+                                                           ETimestampingFlags::TimestampOnly), 0);
+    ASSERT_EQ(sender.GetOption<SocketOption::Timestamping>(flags), 0);
+    ASSERT_EQ(flags & ETimestampingFlags::Id, ETimestampingFlags::Id);
+
+    ASSERT_EQ(clock_gettime(CLOCK_REALTIME, &before), 0);
+    ASSERT_EQ(sender.Send(payload), sizeof(payload));
+    ASSERT_EQ(sender.Send(payload), sizeof(payload));
+
+    // Receive timestamps.
+    for (size_t index = 0; index < 2; index++)
+    {
+        ASSERT_EQ(receiver.ReceiveTimestamped(output, sizeof(output), received), sizeof(payload));
+        ASSERT_TRUE((received.tv_sec > before.tv_sec) ||
+                    ((received.tv_sec == before.tv_sec) && (received.tv_nsec >= before.tv_nsec)));
+    }
+
+    // Transmit timestamps, numbered by send.
+    size_t count = 0;
+    for (int attempt = 0; (attempt < 1000) && (count < 2); attempt++)
+    {
+        int res = sender.ReadTransmitTimestamps(transmitted);
+        ASSERT_GE(res, 0);
+
+        for (int index = 0; index < res; index++)
+        {
+            ASSERT_EQ(transmitted[index].id, count);
+            ASSERT_EQ(transmitted[index].type, ETimestampType::Sent);
+            ASSERT_NE(transmitted[index].time.tv_sec, 0);
+            count++;
+        }
+
+        if (res == 0)
+        {
+            usleep(1000);
+        }
+    }
+    ASSERT_EQ(count, 2);
+
+    // Without timestamps enabled, the timestamp is zeroed.
+    ASSERT_EQ(receiver.SetOption<SocketOption::TimestampNanoseconds>(false), 0);
+    ASSERT_EQ(sender.Send(payload), sizeof(payload));
+    ASSERT_EQ(receiver.ReceiveTimestamped(output, sizeof(output), received), sizeof(payload));
+    ASSERT_EQ(received.tv_sec, 0);
+}
+
+TEST_F(SocketTest, IPv6TransmitTimestamps)
+{
+    const uint8_t payload[8] = {1, 2, 3};
+    const IPv6Address receiverAddress("::1", 0x6678);
+    IPv6Socket sender, receiver;
+    TransmitTimestamp transmitted[4];
+
+    ASSERT_EQ(sender.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Bind(receiverAddress), 0);
+    ASSERT_EQ(sender.Connect(receiverAddress), 0);
+
+    ASSERT_EQ(sender.SetOption<SocketOption::Timestamping>(ETimestampingFlags::TransmitSoftware |
+                                                           ETimestampingFlags::Software |
+                                                           ETimestampingFlags::Id |
+                                                           ETimestampingFlags::TimestampOnly), 0);
+    ASSERT_EQ(sender.Send(payload), sizeof(payload));
+
+    // The extended error of an IPv6 socket carries the offender's address, and fills the control buffer.
+    int res = 0;
+    for (int attempt = 0; (attempt < 1000) && (res == 0); attempt++)
+    {
+        res = sender.ReadTransmitTimestamps(transmitted);
+        ASSERT_GE(res, 0);
+
+        if (res == 0)
+        {
+            usleep(1000);
+        }
+    }
+
+    ASSERT_EQ(res, 1);
+    ASSERT_EQ(transmitted[0].id, 0);
+    ASSERT_EQ(transmitted[0].type, ETimestampType::Sent);
+    ASSERT_NE(transmitted[0].time.tv_sec, 0);
+}
+
+TEST_F(SocketTest, ErrorQueue)
+{
+    static uint8_t payload[16 * 1024];
+    const IPv4Address receiverAddress("127.0.0.1", 0x6679);
+    IPv4Socket sender, receiver, unreachable;
+    ZeroCopyCompletion completions[4];
+    TransmitTimestamp transmitted[4];
+    ErrorQueueMessage messages[2];
+    uint32_t id;
+
+    ASSERT_EQ(sender.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(receiver.Bind(receiverAddress), 0);
+    ASSERT_EQ(sender.Connect(receiverAddress), 0);
+
+    ASSERT_EQ(sender.SetOption<SocketOption::Timestamping>(ETimestampingFlags::TransmitSoftware |
+                                                           ETimestampingFlags::Software |
+                                                           ETimestampingFlags::Id |
+                                                           ETimestampingFlags::TimestampOnly), 0);
+
+    for (uint32_t expected = 0; expected < 2; expected++)
+    {
+        ASSERT_EQ(sender.SendZeroCopy(payload, sizeof(payload), id), sizeof(payload));
+        ASSERT_EQ(id, expected);
+    }
+
+    // Completions and timestamps share the queue; neither reader drops the other's messages.
+    uint32_t completed = 0;
+    size_t timestamps = 0;
+    for (int attempt = 0; (attempt < 1000) && ((completed < 2) || (timestamps < 2)); attempt++)
+    {
+        int count = sender.ReadZeroCopyCompletions(completions);
+        ASSERT_GE(count, 0);
+
+        for (int index = 0; index < count; index++)
+        {
+            ASSERT_EQ(completions[index].first, completed);
+            completed = completions[index].last + 1;
+        }
+
+        int res = sender.ReadTransmitTimestamps(transmitted);
+        ASSERT_GE(res, 0);
+
+        for (int index = 0; index < res; index++)
+        {
+            ASSERT_EQ(transmitted[index].id, timestamps);
+            timestamps++;
+        }
+
+        if ((count == 0) && (res == 0))
+        {
+            usleep(1000);
+        }
+    }
+
+    ASSERT_EQ(completed, 2);
+    ASSERT_EQ(timestamps, 2);
+    ASSERT_EQ(sender.ReadErrorQueue(messages), 0);
+
+    // Errors queued by the network are reported as well.
+    ASSERT_EQ(unreachable.Open(ESocketType::Datagram), 0);
+    ASSERT_EQ(unreachable.SetOption<SocketOption::ReceiveErrors>(true), 0);
+    ASSERT_EQ(unreachable.Connect(IPv4Address("127.0.0.1", 0x667A)), 0);
+    ASSERT_EQ(unreachable.Send(payload, 1), 1);
+
+    int res = 0;
+    for (int attempt = 0; (attempt < 1000) && (res == 0); attempt++)
+    {
+        res = unreachable.ReadErrorQueue(messages);
+        ASSERT_GE(res, 0);
+
+        if (res == 0)
+        {
+            usleep(1000);
+        }
+    }
+
+    ASSERT_EQ(res, 1);
+    ASSERT_EQ(messages[0].type, EErrorQueueMessageType::Error);
+    ASSERT_EQ(messages[0].error.ee_errno, ECONNREFUSED);
+    ASSERT_EQ(messages[0].error.ee_origin, SO_EE_ORIGIN_ICMP);
+}
+
+TEST_F(SocketTest, UnpaddedControlMessage)
+{
+    ControlBuffer<60> control;
+    struct cmsghdr header;
+    size_t count = 0;
+
+    // Like the kernel does, the last record isn't padded up to `CMSG_SPACE`.
+    memset(&header, 0, sizeof(header));
+    header.cmsg_level = SOL_IPV6;
+    header.cmsg_type = IPV6_RECVERR;
+    header.cmsg_len = CMSG_LEN(44);
+    memcpy(control.GetData(), &header, sizeof(header));
+    control.SetLength(CMSG_LEN(44));
+
+    for (ControlMessage message : control.GetMessages())
+    {
+        ASSERT_TRUE(message.Is(SOL_IPV6, IPV6_RECVERR));
+        ASSERT_EQ(message.GetData().length, 44);
+        count++;
+    }
+
+    ASSERT_EQ(count, 1);
+}
@@ -0,0 +1,175 @@
+/**
+ * @file uring_tests.cpp
+ *
+ * @author  Gilad "Salmon" Naaman
+ * @since   18/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <Kraken/IO/URing.h>
+#include <Kraken/Collections.h>
+
+using namespace Kraken;
+
+#define OPEN_RING_OR_SKIP(ring, entries) \
+    do { \
+        int _err = (ring).Open(entries); \
+        if ((_err == -ENOSYS) || (_err == -EPERM)) { GTEST_SKIP() << "io_uring is unavailable"; } \
+        ASSERT_EQ(_err, 0); \
+    } while (0)
+
+TEST(URingTests, Open)
+{
+    URing ring;
+
+    ASSERT_FALSE(ring.IsOpen());
+    OPEN_RING_OR_SKIP(ring, 8);
+    ASSERT_TRUE(ring.IsOpen());
+    ASSERT_EQ(ring.Open(8), -EBUSY);
+
+    URingCompletion completions[4];
+    ASSERT_EQ(ring.Wait(completions, 0), 0);
+}
+
+TEST(URingTests, LinkedSends)
+{
+    const uint8_t first[4] = {0, 1, 2, 3};
+    const uint8_t second[4] = {4, 5, 6, 7};
+    uint8_t output[8] = {0};
+    URing ring;
+    UnixSocket a, b;
+    URingCompletion completions[4];
+
+    OPEN_RING_OR_SKIP(ring, 8);
+    ASSERT_EQ(UnixSocket::Pair(ESocketType::Stream, a, b), 0);
+
+    ASSERT_EQ(ring.Send(a, first, ESendFlags::None, ESubmitFlags::Link), 0);
+    ASSERT_EQ(ring.Send(a, second), 0);
+    ASSERT_EQ(ring.Wait(completions, 2), 2);
+
+    for (size_t index = 0; index < 2; index++)
+    {
+        ASSERT_EQ(completions[index].GetOperation(), EURingOperation::Send);
+        ASSERT_EQ(&completions[index].GetSocket<ESocketDomain::Unix>(), &a);
+        ASSERT_EQ(completions[index].result, 4);
+    }
+
+    ASSERT_EQ(b.Receive(output), sizeof(output));
+    ASSERT_EQ(memcmp(output, first, sizeof(first)), 0);
+    ASSERT_EQ(memcmp(output + 4, second, sizeof(second)), 0);
+}
+
+TEST(URingTests, MultishotAcceptReceive)
+{
+    const uint8_t message[16] = {1, 2, 3};
+    buffer<4 * 64> storage;
+    URing ring;
+    URingBufferRing buffers;
+    IPv4Socket server, remoteClients[2];
+    URingCompletion completions[4];
+
+    OPEN_RING_OR_SKIP(ring, 8);
+
+    IPv4Address serverAddress("127.0.0.1", 0);
+    socklen_t addressLength = serverAddress.GetLength();
+
+    // Let the kernel pick a port; the ring may hold on to the listener for a while after the test.
+    ASSERT_EQ(server.Open(ESocketType::Stream), 0);
+    ASSERT_EQ(server.Bind(serverAddress), 0);
+    ASSERT_EQ(getsockname(server.GetFileDescriptor(), serverAddress.GetBase(), &addressLength), 0);
+    ASSERT_EQ(server.Listen(4), 0);
+
+    int err = buffers.Open(ring, 7, storage, 4);
+    if (err == -EINVAL)
+    {
+        GTEST_SKIP() << "Buffer rings are unsupported";
+    }
+    ASSERT_EQ(err, 0);
+
+    ASSERT_EQ(ring.Accept(server), 0);
+    ASSERT_EQ(ring.Submit(), 1);
+
+    // A single submission accepts both clients.
+    for (auto &remote : remoteClients)
+    {
+        ASSERT_EQ(remote.Open(ESocketType::Stream), 0);
+        ASSERT_EQ(remote.Connect(serverAddress), 0);
+    }
+
+    fd_t clientDescriptors[2] = {-EBADFD, -EBADFD};
+    size_t accepted = 0;
+    while (accepted < 2)
+    {
+        int reaped = ring.Wait(completions, 1);
+        ASSERT_GT(reaped, 0);
+
+        for (int index = 0; index < reaped; index++)
+        {
+            ASSERT_EQ(completions[index].GetOperation(), EURingOperation::Accept);
+            ASSERT_EQ(&completions[index].GetSocket<ESocketDomain::IPv4>(), &server);
+            ASSERT_GE(completions[index].result, 0);
+            ASSERT_TRUE(completions[index].HasMore());
+
+            clientDescriptors[accepted++] = completions[index].result;
+        }
+    }
+
+    IPv4Socket client(clientDescriptors[0]);
+    IPv4Socket otherClient(clientDescriptors[1]);
+
+    ASSERT_EQ(ring.Receive(client, buffers), 0);
+    ASSERT_EQ(remoteClients[0].Send(message), sizeof(message));
+    ASSERT_EQ(remoteClients[0].Send(message), sizeof(message));
+
+    size_t received = 0;
+    while (received < 2 * sizeof(message))
+    {
+        int reaped = ring.Wait(completions, 1);
+        ASSERT_GT(reaped, 0);
+
+        for (int index = 0; index < reaped; index++)
+        {
+            ASSERT_EQ(completions[index].GetOperation(), EURingOperation::Receive);
+            ASSERT_EQ(&completions[index].GetSocket<ESocketDomain::IPv4>(), &client);
+            ASSERT_GT(completions[index].result, 0);
+            ASSERT_TRUE(completions[index].HasBuffer());
+
+            membuf data = buffers.GetBuffer(completions[index]);
+            received += data.length;
+            buffers.Recycle(completions[index]);
+        }
+    }
+
+    ASSERT_EQ(received, 2 * sizeof(message));
+}
+
+TEST(URingTests, BufferRingOutlivesRing)
+{
+    buffer<4 * 64> storage, otherStorage;
+    URingBufferRing buffers, otherBuffers;
+    URing ring, other;
+
+    OPEN_RING_OR_SKIP(ring, 8);
+
+    int err = buffers.Open(ring, 7, storage, 4);
+    if (err == -EINVAL)
+    {
+        GTEST_SKIP() << "Buffer rings are unsupported";
+    }
+    ASSERT_EQ(err, 0);
+
+    // Another instance reuses the descriptor number, and registers the same group.
+    fd_t descriptor = ring.GetFileDescriptor();
+    ring.Close();
+    OPEN_RING_OR_SKIP(other, 8);
+    ASSERT_EQ(other.GetFileDescriptor(), descriptor);
+    ASSERT_EQ(otherBuffers.Open(other, 7, otherStorage, 4), 0);
+
+    // Closing the detached buffer ring leaves the other registration alone.
+    buffers.Close();
+    ASSERT_FALSE(buffers.IsOpen());
+    ASSERT_EQ(buffers.Open(other, 7, storage, 4), -EEXIST);
+
+    otherBuffers.Close();
+    ASSERT_EQ(buffers.Open(other, 7, storage, 4), 0);
+}